@@ -0,0 +1,259 @@
+/*!
+ * @file bench_ghupdate.cpp
+ * @brief Microbenchmarks of the CPU-bound helpers of gh-update-checker
+ *
+ * Covers:
+ *  - SemVer::parse on plain, prefixed and pre-release versions
+ *  - SemVer comparison and sorting of a tag list
+ *  - to_github_api_url (interned lookup) and the uncached URL conversion
+ *  - tag_name extraction from release documents of several sizes, with the
+ *    full nlohmann::json parse as a baseline
+ *  - a complete check_github_update() over an in-process Transport, i.e.
+ *    the CPU cost of a check without the network
+ *
+ * Every benchmark reports an "allocs/op" counter next to the time per
+ * operation, taken from a replaced global operator new, so allocation
+ * regressions show up as clearly as slowdowns. Allocations libcurl makes
+ * with malloc() are not included.
+ *
+ * @example
+ * ```bash
+ * cmake -B build -DGHUPDATE_BUILD_BENCHMARKS=ON -DCMAKE_BUILD_TYPE=Release
+ * cmake --build build --target bench_ghupdate
+ * ./build/bench_ghupdate --benchmark_filter=SemVer
+ * ```
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <check_gh-update.hpp>
+#include <release_fixtures.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// ---------------------------------------------------------
+// Allocation counting
+// ---------------------------------------------------------
+
+namespace {
+
+std::atomic<std::uint64_t> allocations{0};
+
+/*!
+ * @brief Adds the allocations/op counter for the loop that started at @p before
+ */
+void report_allocations(benchmark::State& state, std::uint64_t before) {
+    state.counters["allocs/op"] = benchmark::Counter(
+        static_cast<double>(allocations.load(std::memory_order_relaxed) - before),
+        benchmark::Counter::kAvgIterations);
+}
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+// Kept out of line so the compiler pairs callers with operator new, not malloc
+#if defined(__GNUC__)
+#define GHUPDATE_BENCH_NOINLINE [[gnu::noinline]]
+#else
+#define GHUPDATE_BENCH_NOINLINE
+#endif
+GHUPDATE_BENCH_NOINLINE void operator delete(void* p) noexcept { std::free(p); }
+GHUPDATE_BENCH_NOINLINE void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+// ---------------------------------------------------------
+// SemVer
+// ---------------------------------------------------------
+
+void BM_SemVerParse(benchmark::State& state, std::string_view version) {
+    const auto before = allocations.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(version);
+        benchmark::DoNotOptimize(ghupdate::SemVer::parse(version));
+    }
+    report_allocations(state, before);
+}
+BENCHMARK_CAPTURE(BM_SemVerParse, plain, std::string_view("3.11.2"));
+BENCHMARK_CAPTURE(BM_SemVerParse, prefixed, std::string_view("release-v10.20.30"));
+BENCHMARK_CAPTURE(BM_SemVerParse, prerelease, std::string_view("v2.0.0-rc.1+build.20260115"));
+
+void BM_SemVerCompare(benchmark::State& state, std::string_view lhs, std::string_view rhs) {
+    const ghupdate::SemVer a = ghupdate::SemVer::parse(lhs);
+    const ghupdate::SemVer b = ghupdate::SemVer::parse(rhs);
+    const auto before = allocations.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        benchmark::DoNotOptimize(a < b);
+    }
+    report_allocations(state, before);
+}
+BENCHMARK_CAPTURE(BM_SemVerCompare, normal, std::string_view("3.11.2"), std::string_view("3.11.3"));
+BENCHMARK_CAPTURE(BM_SemVerCompare, prerelease, std::string_view("1.0.0-alpha.beta.11"),
+                  std::string_view("1.0.0-alpha.beta.2"));
+
+// Tag lists as returned by a repository with a long release history
+std::vector<ghupdate::SemVer> version_list(std::size_t count) {
+    std::vector<ghupdate::SemVer> versions;
+    versions.reserve(count);
+    std::uint32_t seed = 12345;
+    for (std::size_t i = 0; i < count; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        std::string tag = "v" + std::to_string(seed % 5) + "." + std::to_string((seed >> 8) % 20) + "." +
+                          std::to_string((seed >> 16) % 30);
+        if (seed % 7 == 0)
+            tag += "-rc." + std::to_string((seed >> 4) % 4);
+        versions.push_back(ghupdate::SemVer::parse(tag));
+    }
+    return versions;
+}
+
+void BM_SemVerSort(benchmark::State& state) {
+    const std::vector<ghupdate::SemVer> input = version_list(static_cast<std::size_t>(state.range(0)));
+    std::vector<ghupdate::SemVer> work = input;
+    const auto before = allocations.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        std::copy(input.begin(), input.end(), work.begin());
+        std::sort(work.begin(), work.end());
+        benchmark::DoNotOptimize(work.data());
+    }
+    report_allocations(state, before);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SemVerSort)->Arg(64)->Arg(1024);
+
+// ---------------------------------------------------------
+// URL conversion
+// ---------------------------------------------------------
+
+void BM_ToGithubApiUrl(benchmark::State& state, std::string_view url) {
+    ghupdate::to_github_api_url(url);  // intern outside the measured loop
+    const auto before = allocations.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(url);
+        benchmark::DoNotOptimize(ghupdate::to_github_api_url(url));
+    }
+    report_allocations(state, before);
+}
+BENCHMARK_CAPTURE(BM_ToGithubApiUrl, https, std::string_view("https://github.com/nlohmann/json"));
+BENCHMARK_CAPTURE(BM_ToGithubApiUrl, ssh, std::string_view("git@github.com:nlohmann/json.git"));
+
+void BM_ToGithubApiUrlView(benchmark::State& state, std::string_view url) {
+    ghupdate::to_github_api_url_view(url);
+    const auto before = allocations.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(url);
+        benchmark::DoNotOptimize(ghupdate::to_github_api_url_view(url));
+    }
+    report_allocations(state, before);
+}
+BENCHMARK_CAPTURE(BM_ToGithubApiUrlView, https, std::string_view("https://github.com/nlohmann/json"));
+
+// The conversion itself, as paid once per distinct spelling
+void BM_ParseGithubApiUrl(benchmark::State& state, std::string_view url) {
+    const auto before = allocations.load(std::memory_order_relaxed);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(url);
+        benchmark::DoNotOptimize(ghupdate::detail::parse_github_api_url(url));
+    }
+    report_allocations(state, before);
+}
+BENCHMARK_CAPTURE(BM_ParseGithubApiUrl, https, std::string_view("https://github.com/nlohmann/json"));
+BENCHMARK_CAPTURE(BM_ParseGithubApiUrl, tree, std::string_view("https://www.github.com/nlohmann/json/tree/develop"));
+BENCHMARK_CAPTURE(BM_ParseGithubApiUrl, ssh, std::string_view("ssh://git@github.com:22/nlohmann/json.git"));
+
+// ---------------------------------------------------------
+// tag_name extraction
+// ---------------------------------------------------------
+
+void BM_ParseLatestTag(benchmark::State& state, ghupdate::fixtures::ReleaseShape shape) {
+    const std::string json = ghupdate::fixtures::release_json("nlohmann/json", "v3.11.3", shape);
+    const auto before = allocations.load(std::memory_order_relaxed);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(ghupdate::parse_latest_tag(json));
+    report_allocations(state, before);
+    state.counters["doc_bytes"] = static_cast<double>(json.size());
+}
+BENCHMARK_CAPTURE(BM_ParseLatestTag, small, ghupdate::fixtures::kSmallRelease);
+BENCHMARK_CAPTURE(BM_ParseLatestTag, medium, ghupdate::fixtures::kMediumRelease);
+BENCHMARK_CAPTURE(BM_ParseLatestTag, large, ghupdate::fixtures::kLargeRelease);
+BENCHMARK_CAPTURE(BM_ParseLatestTag, large_tag_last,
+                  ghupdate::fixtures::ReleaseShape{160, 64 * 1024, true});
+
+// Baseline: building the full DOM as the checker did before streaming extraction
+void BM_NlohmannParseTag(benchmark::State& state, ghupdate::fixtures::ReleaseShape shape) {
+    const std::string json = ghupdate::fixtures::release_json("nlohmann/json", "v3.11.3", shape);
+    const auto before = allocations.load(std::memory_order_relaxed);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(nlohmann::json::parse(json).at("tag_name").get<std::string>());
+    report_allocations(state, before);
+    state.counters["doc_bytes"] = static_cast<double>(json.size());
+}
+BENCHMARK_CAPTURE(BM_NlohmannParseTag, small, ghupdate::fixtures::kSmallRelease);
+BENCHMARK_CAPTURE(BM_NlohmannParseTag, large, ghupdate::fixtures::kLargeRelease);
+
+// Tag extraction plus both SemVer parses and the comparison
+void BM_ParseUpdateInfo(benchmark::State& state) {
+    const std::string json =
+        ghupdate::fixtures::release_json("nlohmann/json", "v3.11.3", ghupdate::fixtures::kMediumRelease);
+    const auto before = allocations.load(std::memory_order_relaxed);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(ghupdate::parse_update_info(json, "3.11.2"));
+    report_allocations(state, before);
+}
+BENCHMARK(BM_ParseUpdateInfo);
+
+// ---------------------------------------------------------
+// Complete check without the network
+// ---------------------------------------------------------
+
+/*!
+ * @brief Transport answering every request with one recorded release
+ */
+class ReplayTransport : public ghupdate::Transport {
+public:
+    explicit ReplayTransport(ghupdate::fixtures::ReleaseShape shape)
+        : body_(ghupdate::fixtures::release_json("nlohmann/json", "v3.11.3", shape)) {}
+
+    ghupdate::HttpResponse get(const ghupdate::TransportRequest&, const BodySink& onBody) override {
+        ghupdate::HttpResponse response;
+        response.status = 200;
+        // Chunked like a network read, so the check can stop after tag_name
+        for (std::size_t i = 0; i < body_.size() && onBody(std::string_view(body_).substr(i, 16 * 1024));
+             i += 16 * 1024) {
+        }
+        return response;
+    }
+
+private:
+    std::string body_;
+};
+
+void BM_CheckOverTransport(benchmark::State& state, ghupdate::fixtures::ReleaseShape shape) {
+    ReplayTransport transport(shape);
+    const ghupdate::CheckOptions options{.transport = &transport};
+    const auto before = allocations.load(std::memory_order_relaxed);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(ghupdate::check_github_update("https://github.com/nlohmann/json", "3.11.2", options));
+    report_allocations(state, before);
+}
+BENCHMARK_CAPTURE(BM_CheckOverTransport, small, ghupdate::fixtures::kSmallRelease);
+BENCHMARK_CAPTURE(BM_CheckOverTransport, large, ghupdate::fixtures::kLargeRelease);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,278 @@
+/*!
+ * @file load_ghupdate.cpp
+ * @brief Offline end-to-end load benchmark of the update check paths
+ *
+ * Starts a MockGitHubServer in-process and drives a fixed number of checks
+ * through each check path, reporting checks per second and the latency
+ * distribution (p50, p99, max) of single checks:
+ *  - sync:   check_github_update() from --concurrency threads (new connection per check)
+ *  - client: one persistent Client per thread
+ *  - async:  check_github_update_async() with --concurrency futures in flight
+ *            (a latency is taken when its future is collected, oldest first)
+ *  - batch:  check_github_updates() with --concurrency workers
+ *  - multi:  MultiEngine with --concurrency transfers in flight
+ *
+ * No network access or API quota is needed, so runs are repeatable and can
+ * be compared before and after a change.
+ *
+ * @example
+ * ```bash
+ * ./build/load_ghupdate --checks 5000 --concurrency 32 --latency-ms 20 --paths client,batch,multi
+ * ```
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <check_gh-update.hpp>
+#include <ghupdate/latency_histogram.hpp>
+#include <ghupdate/multi_engine.hpp>
+#include <mock_github_server.hpp>
+#include <charconv>
+#include <cstdio>
+#include <deque>
+#include <iostream>
+#include <semaphore>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/*!
+ * @struct LoadOptions
+ * @brief Command line options of the load benchmark
+ */
+struct LoadOptions {
+    std::size_t checks = 2000;       ///< Checks per path
+    std::size_t concurrency = 16;    ///< Checks in flight
+    std::size_t repos = 64;          ///< Distinct repositories checked round-robin
+    std::string paths = "sync,client,async,batch,multi";
+    bool etags = false;              ///< Revalidate with a ValidatorStore (304 answers) where supported
+    ghupdate::fixtures::MockOptions mock{};
+    ghupdate::fixtures::ReleaseShape shape = ghupdate::fixtures::kMediumRelease;
+};
+
+/*!
+ * @struct LoadResult
+ * @brief Outcome of running one path
+ */
+struct LoadResult {
+    ghupdate::LatencyHistogram latency;
+    std::size_t errors = 0;
+    Clock::duration wall{};
+};
+
+void print_usage(const char* program) {
+    std::cerr << "Usage: " << program << " [options]\n\n";
+    std::cerr << "Options:\n";
+    std::cerr << "  --checks N          Checks per path (default 2000)\n";
+    std::cerr << "  --concurrency N     Checks in flight (default 16)\n";
+    std::cerr << "  --repos N           Distinct repositories (default 64)\n";
+    std::cerr << "  --paths LIST        Comma separated: sync,client,async,batch,multi (default all)\n";
+    std::cerr << "  --latency-ms N      Server latency per response (default 0)\n";
+    std::cerr << "  --jitter-ms N       Extra random server latency up to N ms (default 0)\n";
+    std::cerr << "  --error-every N     Answer every N-th request with 503 (default never)\n";
+    std::cerr << "  --shape SIZE        Release document: small, medium or large (default medium)\n";
+    std::cerr << "  --etags             Revalidate with ETags, so repeated checks get 304 answers\n";
+}
+
+std::optional<LoadOptions> parse_args(int argc, char* argv[]) {
+    LoadOptions options;
+    auto number = [](std::string_view text) -> std::optional<std::size_t> {
+        std::size_t value = 0;
+        auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec != std::errc{} || ptr != text.data() + text.size())
+            return std::nullopt;
+        return value;
+    };
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--etags") {
+            options.etags = true;
+            continue;
+        }
+        if (i + 1 >= argc)
+            return std::nullopt;
+        std::string_view value = argv[++i];
+        auto n = number(value);
+        if (arg == "--checks" && n && *n) options.checks = *n;
+        else if (arg == "--concurrency" && n && *n) options.concurrency = *n;
+        else if (arg == "--repos" && n && *n) options.repos = *n;
+        else if (arg == "--paths") options.paths = value;
+        else if (arg == "--latency-ms" && n) options.mock.latency = std::chrono::milliseconds(*n);
+        else if (arg == "--jitter-ms" && n) options.mock.jitter = std::chrono::milliseconds(*n);
+        else if (arg == "--error-every" && n) options.mock.errorEvery = *n;
+        else if (arg == "--shape" && value == "small") options.shape = ghupdate::fixtures::kSmallRelease;
+        else if (arg == "--shape" && value == "medium") options.shape = ghupdate::fixtures::kMediumRelease;
+        else if (arg == "--shape" && value == "large") options.shape = ghupdate::fixtures::kLargeRelease;
+        else return std::nullopt;
+    }
+    return options;
+}
+
+std::chrono::microseconds micros(Clock::duration d) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(d);
+}
+
+// Runs checks 0..count-1 on `threads` threads; check(i) performs one check
+template <typename Check>
+LoadResult run_threads(std::size_t count, std::size_t threads, Check check) {
+    std::atomic<std::size_t> next{0};
+    std::vector<LoadResult> partial(threads);
+    const auto started = Clock::now();
+    {
+        std::vector<std::jthread> workers;
+        for (std::size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                for (std::size_t i; (i = next.fetch_add(1)) < count;) {
+                    const auto begin = Clock::now();
+                    try {
+                        check(t, i);
+                    } catch (const std::exception&) {
+                        ++partial[t].errors;
+                    }
+                    partial[t].latency.record(micros(Clock::now() - begin));
+                }
+            });
+        }
+    }
+    LoadResult result;
+    result.wall = Clock::now() - started;
+    for (const auto& p : partial) {
+        result.latency.merge(p.latency);
+        result.errors += p.errors;
+    }
+    return result;
+}
+
+LoadResult run_path(std::string_view path, const LoadOptions& options,
+                    const std::vector<ghupdate::RepoCheck>& repos) {
+    const std::size_t count = options.checks;
+    const std::size_t concurrency = options.concurrency;
+    auto repo = [&](std::size_t i) -> const ghupdate::RepoCheck& { return repos[i % repos.size()]; };
+    ghupdate::ValidatorStore validators;
+    const ghupdate::CheckOptions check{.validators = options.etags ? &validators : nullptr};
+
+    if (path == "sync") {
+        return run_threads(count, concurrency, [&](std::size_t, std::size_t i) {
+            ghupdate::check_github_update(repo(i).repoUrl, repo(i).localVersion, check);
+        });
+    }
+
+    if (path == "client") {
+        std::vector<ghupdate::Client> clients(concurrency);
+        return run_threads(count, concurrency, [&](std::size_t t, std::size_t i) {
+            clients[t].check(repo(i).repoUrl, repo(i).localVersion, check);
+        });
+    }
+
+    LoadResult result;
+    const auto started = Clock::now();
+
+    if (path == "async") {
+        std::deque<std::pair<std::future<ghupdate::UpdateInfo>, Clock::time_point>> inFlight;
+        auto finish = [&] {
+            try {
+                inFlight.front().first.get();
+            } catch (const std::exception&) {
+                ++result.errors;
+            }
+            result.latency.record(micros(Clock::now() - inFlight.front().second));
+            inFlight.pop_front();
+        };
+        for (std::size_t i = 0; i < count; ++i) {
+            if (inFlight.size() == concurrency)
+                finish();
+            inFlight.emplace_back(ghupdate::check_github_update_async(repo(i).repoUrl, repo(i).localVersion),
+                                  Clock::now());
+        }
+        while (!inFlight.empty())
+            finish();
+    } else if (path == "batch") {
+        std::vector<ghupdate::RepoCheck> entries;
+        entries.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            entries.push_back(repo(i));
+        ghupdate::BatchOptions batch{.concurrency = concurrency, .check = check};
+        batch.onComplete = [&](std::size_t, const ghupdate::CheckResult& r, Clock::duration elapsed) {
+            result.errors += r ? 0 : 1;
+            result.latency.record(micros(elapsed));
+        };
+        ghupdate::check_github_updates(entries, batch);
+    } else if (path == "multi") {
+        // Plain HTTP/1.1 server: one connection per transfer in flight
+        ghupdate::MultiEngine engine({.maxInFlight = concurrency, .http2Multiplex = false});
+        std::counting_semaphore<> slots(static_cast<std::ptrdiff_t>(concurrency));
+        std::mutex mutex;
+        for (std::size_t i = 0; i < count; ++i) {
+            slots.acquire();
+            engine.submit(repo(i).repoUrl, repo(i).localVersion,
+                          [&, begin = Clock::now()](ghupdate::CheckResult r) {
+                              {
+                                  std::lock_guard lock(mutex);
+                                  result.errors += r ? 0 : 1;
+                                  result.latency.record(micros(Clock::now() - begin));
+                              }
+                              slots.release();
+                          });
+        }
+        for (std::size_t i = 0; i < concurrency; ++i)
+            slots.acquire();
+    } else {
+        throw std::runtime_error("Unknown path: " + std::string(path));
+    }
+
+    result.wall = Clock::now() - started;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    auto options = parse_args(argc, argv);
+    if (!options) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    try {
+        ghupdate::fixtures::MockGitHubServer server(options->mock);
+        std::vector<ghupdate::RepoCheck> repos;
+        for (std::size_t i = 0; i < options->repos; ++i) {
+            const std::string slug = "load/repo" + std::to_string(i);
+            server.set_release(slug, "v1.2.3", options->shape);
+            repos.push_back({server.api_url(slug), "1.0.0"});
+        }
+
+        std::printf("%zu checks per path, concurrency %zu, %zu repositories, server latency %lld ms\n\n",
+                    options->checks, options->concurrency, options->repos,
+                    static_cast<long long>(options->mock.latency.count() / 1000));
+        std::printf("%-8s %10s %8s %10s %10s %10s %10s\n", "path", "checks/s", "errors", "p50 ms", "p90 ms",
+                    "p99 ms", "max ms");
+
+        auto ms = [](std::chrono::microseconds us) { return static_cast<double>(us.count()) / 1000.0; };
+        std::string_view paths = options->paths;
+        while (!paths.empty()) {
+            std::string_view path = paths.substr(0, paths.find(','));
+            paths.remove_prefix(std::min(paths.size(), path.size() + 1));
+
+            const auto before = server.stats();
+            LoadResult r = run_path(path, *options, repos);
+            const auto after = server.stats();
+            const double seconds = std::chrono::duration<double>(r.wall).count();
+            std::printf("%-8.*s %10.0f %8zu %10.3f %10.3f %10.3f %10.3f   (%llu connections, %llu not modified)\n",
+                        static_cast<int>(path.size()), path.data(),
+                        static_cast<double>(options->checks) / seconds, r.errors, ms(r.latency.percentile(0.5)),
+                        ms(r.latency.percentile(0.9)), ms(r.latency.percentile(0.99)), ms(r.latency.max()),
+                        static_cast<unsigned long long>(after.connections - before.connections),
+                        static_cast<unsigned long long>(after.notModified - before.notModified));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << "\n";
+        return 3;
+    }
+    return 0;
+}
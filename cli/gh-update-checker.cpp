@@ -7,7 +7,9 @@
  * It uses semantic versioning (SemVer) for version comparison.
  *
  * Usage:
- *  gh-update-checker <repo-url-or-api-url> <local-version>
+ *  gh-update-checker [options] <repo-url-or-api-url> <local-version>
+ *  gh-update-checker [options] --manifest <file|->
+ *  gh-update-checker [options] --watch (--manifest <file|-> | <repo-url-or-api-url> <local-version>)
  *
  * Arguments:
  *  - repo-url-or-api-url: GitHub repository URL or GitHub API release URL
@@ -16,15 +18,65 @@
  *      - https://api.github.com/repos/nlohmann/json/releases/latest
  *  - local-version: Local version string in SemVer format (e.g., "3.11.2", "v1.0")
  *
+ * Options:
+ *  - --cache-ttl SECONDS: Answer from an on-disk cache shared by all
+ *    invocations while the cached result is younger than SECONDS
+ *    (default: $GH_UPDATE_CHECKER_CACHE_TTL, cache disabled if unset)
+ *  - --stale-while-revalidate SECONDS: Keep serving an expired entry for
+ *    SECONDS more. The invocation that claims the refresh prints the cached
+ *    answer first but only exits after its network request; all others
+ *    exit immediately
+ *  - --cache-dir DIR: Cache directory (default: $XDG_CACHE_HOME/gh-update-checker)
+ *  - --no-cache: Disable the on-disk cache
+ *  - --manifest FILE: Check every repository listed in FILE ("-" reads
+ *    stdin) instead of a single one. The manifest is either plain text with
+ *    one "<repo> <local-version>" pair per line ('#' starts a comment) or
+ *    JSON: an array of {"repo": ..., "version": ...} objects or an object
+ *    mapping repositories to versions
+ *  - --jobs N: Number of checks run concurrently in manifest and watch mode (default: 8)
+ *  - --watch: Keep running and re-check every repository periodically,
+ *    printing a record only when its result changes; stops on SIGINT or
+ *    SIGTERM. Connections and ETags are reused across checks; the on-disk
+ *    cache is not used
+ *  - --interval SECONDS: Default re-check interval in watch mode (default:
+ *    300); a manifest may set it per repository as a third column or an
+ *    "interval" field
+ *  - --timings: After a manifest run, print per-phase latency percentiles
+ *    (DNS, connect, TLS, first byte, transfer, parsing, waits) to stderr
+ *  - --metrics-file PATH: Write Prometheus metrics (requests, 304 answers,
+ *    cache hits, retries, rate limit budget, per-phase latency histograms)
+ *    to PATH for node_exporter's textfile collector; after a manifest run,
+ *    and every 15 seconds in watch mode
+ *  - --metrics-listen [HOST:]PORT: In watch mode, serve the metrics on
+ *    http://HOST:PORT/metrics (HOST defaults to 127.0.0.1; POSIX only)
+ *  - --format FORMAT: Output format: "text" (default), or one machine
+ *    readable record per repository as "json" (an array streamed element by
+ *    element), "ndjson" (one object per line) or "csv" (with header line).
+ *    Records carry repo, local_version, latest_version, update, error,
+ *    latency_ms and cache_hit
+ *
+ * Options taking a value also accept the "--option=value" form.
+ *
  * Exit Codes:
  *  - 0: Success - no update available (local version is current)
- *  - 1: Usage error - invalid number of arguments
+ *  - 1: Usage error - invalid arguments
  *  - 2: Success - update available (newer version found)
  *  - 3: Runtime error - network, API, or parsing error
  *
+ * In manifest mode the exit code is 3 if any check failed, otherwise 2 if
+ * any update is available, otherwise 0. Watch mode exits with 0 once
+ * interrupted.
+ *
  * Output:
  *  - Prints comparison results to stdout
  *  - Prints error messages to stderr
+ *  - In manifest mode prints one line per repository as soon as its check
+ *    completes ("UPDATE", "OK" or "ERROR", the repository, then the
+ *    versions or the error message), so completion order may differ from
+ *    manifest order
+ *  - With a machine readable --format, check errors are reported in the
+ *    records instead of on stderr; output is buffered and flushed at least
+ *    every 50 ms
  *
  * @example
  * ```bash
@@ -41,15 +93,714 @@
  * Update:         NO
  * $ echo $?
  * 0
+ *
+ * $ printf 'https://github.com/nlohmann/json 3.11.2\nhttps://github.com/curl/curl 8.7.0\n' | gh-update-checker --jobs 4 --manifest -
+ * OK      https://github.com/curl/curl 8.7.0
+ * UPDATE  https://github.com/nlohmann/json 3.11.2 -> v3.11.3
+ *
+ * $ gh-update-checker --format=ndjson https://github.com/nlohmann/json 3.11.2
+ * {"repo":"https://github.com/nlohmann/json","local_version":"3.11.2","latest_version":"v3.11.3","update":true,"error":null,"latency_ms":412.337,"cache_hit":false}
  * ```
  *
  * @author Your Team
  * @version 1.0.0
  */
 
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 #include <check_gh-update.hpp>
+#include <ghupdate/disk_cache.hpp>
+#include <ghupdate/latency_histogram.hpp>
+#include <ghupdate/metrics_registry.hpp>
+#if !defined(_WIN32)
+#include <ghupdate/metrics_server.hpp>
+#endif
+#include <ghupdate/watcher.hpp>
+
+namespace {
+
+/*!
+ * @brief Output format of the check results
+ */
+enum class OutputFormat {
+    Text,    ///< Human readable lines
+    Json,    ///< JSON array of records
+    Ndjson,  ///< One JSON record per line
+    Csv,     ///< CSV with header line
+};
+
+/*!
+ * @struct CliOptions
+ * @brief Parsed command-line arguments
+ */
+struct CliOptions {
+    std::string repo;                            ///< Repository URL or API URL
+    std::string local;                           ///< Local version string
+    std::optional<std::chrono::seconds> cacheTtl;  ///< On-disk cache TTL (cache disabled if unset)
+    std::chrono::seconds staleWhileRevalidate{0};  ///< Stale-while-revalidate window
+    std::filesystem::path cacheDir;              ///< Cache directory (default if empty)
+    std::string manifest;                        ///< Manifest file ("-" for stdin); single check if empty
+    std::size_t jobs = 8;                        ///< Concurrent checks in manifest and watch mode
+    bool watch = false;                          ///< Re-check periodically until interrupted
+    bool timings = false;                        ///< Print per-phase latency histograms of a manifest run
+    std::filesystem::path metricsFile;           ///< Prometheus textfile to write (none if empty)
+    std::string metricsHost = "127.0.0.1";       ///< Address of the /metrics endpoint
+    std::optional<std::uint16_t> metricsPort;    ///< Port of the /metrics endpoint (none if unset)
+    std::chrono::seconds interval{300};          ///< Default re-check interval in watch mode
+    OutputFormat format = OutputFormat::Text;    ///< Output format
+};
+
+/*!
+ * @brief Prints the usage text to stderr
+ */
+void print_usage() {
+    std::cerr << "Usage: gh-update-checker [options] <repo-url-or-api-url> <local-version>\n";
+    std::cerr << "       gh-update-checker [options] --manifest <file|->\n";
+    std::cerr << "       gh-update-checker [options] --watch (--manifest <file|-> | <repo> <local-version>)\n";
+    std::cerr << "Options:\n";
+    std::cerr << "  --cache-ttl SECONDS               Serve results from the on-disk cache while younger than SECONDS\n";
+    std::cerr << "  --stale-while-revalidate SECONDS  Serve expired results for SECONDS more; the one run that\n";
+    std::cerr << "                                    refreshes them still waits for its request before exiting\n";
+    std::cerr << "  --cache-dir DIR                   Cache directory\n";
+    std::cerr << "  --no-cache                        Disable the on-disk cache\n";
+    std::cerr << "  --manifest FILE                   Check all '<repo> <version>' lines (or JSON) of FILE, - for stdin\n";
+    std::cerr << "  --jobs N                          Concurrent checks in manifest and watch mode (default: 8)\n";
+    std::cerr << "  --watch                           Re-check periodically, print only changed results\n";
+    std::cerr << "  --interval SECONDS                Default re-check interval in watch mode (default: 300)\n";
+    std::cerr << "  --timings                         Print per-phase latency percentiles of a manifest run\n";
+    std::cerr << "  --metrics-file PATH               Write Prometheus metrics for the textfile collector\n";
+    std::cerr << "  --metrics-listen [HOST:]PORT      Serve metrics on http://HOST:PORT/metrics in watch mode\n";
+    std::cerr << "  --format FORMAT                   Output as text (default), json, ndjson or csv\n";
+    std::cerr << "Example:\n";
+    std::cerr << "  gh-update-checker "
+                 "https://api.github.com/repos/nlohmann/json/releases/latest 3.11.2\n";
+}
+
+/*!
+ * @brief Parses a non-negative number of seconds
+ * @return Parsed duration, or std::nullopt if @p text is not a number
+ */
+std::optional<std::chrono::seconds> parse_seconds(std::string_view text) {
+    long long value = 0;
+    auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (ec != std::errc{} || ptr != text.data() + text.size() || value < 0)
+        return std::nullopt;
+    return std::chrono::seconds{value};
+}
+
+/*!
+ * @brief Parses the command line
+ * @return Parsed options, or std::nullopt on a usage error
+ */
+std::optional<CliOptions> parse_args(int argc, char** argv) {
+    CliOptions options;
+    if (const char* env = std::getenv("GH_UPDATE_CHECKER_CACHE_TTL"); env && *env)
+        options.cacheTtl = parse_seconds(env);
+
+    std::vector<std::string> positional;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        std::optional<std::string_view> inlineValue;
+        if (auto eq = arg.find('='); arg.starts_with("--") && eq != std::string_view::npos) {
+            inlineValue = arg.substr(eq + 1);
+            arg = arg.substr(0, eq);
+        }
+        auto value = [&]() -> std::optional<std::string_view> {
+            if (inlineValue) return inlineValue;
+            if (i + 1 >= argc) return std::nullopt;
+            return std::string_view(argv[++i]);
+        };
+
+        if (arg == "--cache-ttl") {
+            auto v = value();
+            if (!v || !(options.cacheTtl = parse_seconds(*v))) return std::nullopt;
+        } else if (arg == "--stale-while-revalidate") {
+            auto v = value();
+            auto seconds = v ? parse_seconds(*v) : std::nullopt;
+            if (!seconds) return std::nullopt;
+            options.staleWhileRevalidate = *seconds;
+        } else if (arg == "--cache-dir") {
+            auto v = value();
+            if (!v) return std::nullopt;
+            options.cacheDir = *v;
+        } else if (arg == "--no-cache") {
+            if (inlineValue) return std::nullopt;
+            options.cacheTtl.reset();
+        } else if (arg == "--manifest") {
+            auto v = value();
+            if (!v || v->empty()) return std::nullopt;
+            options.manifest = *v;
+        } else if (arg == "--jobs") {
+            auto v = value();
+            std::size_t jobs = 0;
+            if (!v) return std::nullopt;
+            auto [ptr, ec] = std::from_chars(v->data(), v->data() + v->size(), jobs);
+            if (ec != std::errc{} || ptr != v->data() + v->size() || jobs == 0) return std::nullopt;
+            options.jobs = jobs;
+        } else if (arg == "--timings") {
+            if (inlineValue) return std::nullopt;
+            options.timings = true;
+        } else if (arg == "--metrics-file") {
+            auto v = value();
+            if (!v || v->empty()) return std::nullopt;
+            options.metricsFile = *v;
+        } else if (arg == "--metrics-listen") {
+            auto v = value();
+            if (!v || v->empty()) return std::nullopt;
+            // "PORT", "HOST:PORT" or "[IPv6]:PORT"
+            std::string_view port = *v;
+            if (auto colon = port.rfind(':'); colon != std::string_view::npos) {
+                std::string_view host = port.substr(0, colon);
+                if (host.size() >= 2 && host.front() == '[' && host.back() == ']')
+                    host = host.substr(1, host.size() - 2);
+                options.metricsHost = host;
+                port.remove_prefix(colon + 1);
+            }
+            std::uint16_t number = 0;
+            auto [ptr, ec] = std::from_chars(port.data(), port.data() + port.size(), number);
+            if (ec != std::errc{} || ptr != port.data() + port.size()) return std::nullopt;
+            options.metricsPort = number;
+        } else if (arg == "--watch") {
+            if (inlineValue) return std::nullopt;
+            options.watch = true;
+        } else if (arg == "--interval") {
+            auto v = value();
+            auto seconds = v ? parse_seconds(*v) : std::nullopt;
+            if (!seconds || *seconds == std::chrono::seconds(0)) return std::nullopt;
+            options.interval = *seconds;
+        } else if (arg == "--format") {
+            auto v = value();
+            if (!v) return std::nullopt;
+            if (*v == "text") options.format = OutputFormat::Text;
+            else if (*v == "json") options.format = OutputFormat::Json;
+            else if (*v == "ndjson") options.format = OutputFormat::Ndjson;
+            else if (*v == "csv") options.format = OutputFormat::Csv;
+            else return std::nullopt;
+        } else if (arg.starts_with("--")) {
+            return std::nullopt;
+        } else {
+            positional.emplace_back(arg);
+        }
+    }
+
+    if (!options.manifest.empty())
+        return positional.empty() ? std::optional(options) : std::nullopt;
+    if (positional.size() != 2)
+        return std::nullopt;
+    options.repo = positional[0];
+    options.local = positional[1];
+    return options;
+}
+
+/*!
+ * @brief Prints the comparison result to stdout
+ */
+void print_result(const std::string& local, const ghupdate::UpdateInfo& info) {
+    std::cout << "Local version:  " << local << "\n";
+    std::cout << "Remote version: " << info.latestVersion << "\n";
+    std::cout << "Update:         " << (info.hasUpdate ? "YES" : "NO") << "\n";
+}
+
+/*!
+ * @brief Runs a single check through the on-disk cache
+ *
+ * Fresh entries are answered without network I/O. Stale entries inside
+ * the stale-while-revalidate window are printed immediately; afterwards
+ * the invocation that wins the revalidation claim refreshes the entry
+ * synchronously, so that invocation still pays for one full request
+ * before it exits. Concurrent invocations exit without network I/O.
+ *
+ * @return Process exit code
+ */
+int run_cached(const CliOptions& options) {
+    ghupdate::DiskCache cache(
+        options.cacheDir.empty() ? ghupdate::DiskCache::default_directory() : options.cacheDir,
+        *options.cacheTtl, options.staleWhileRevalidate);
+
+    std::string key = ghupdate::github_repo_slug(options.repo);
+    auto hit = cache.lookup(key);
+
+    if (hit.state != ghupdate::DiskCache::State::Miss) {
+        ghupdate::UpdateInfo info{
+            ghupdate::SemVer::parse(hit.latestVersion) > ghupdate::SemVer::parse(options.local),
+            hit.latestVersion};
+        print_result(options.local, info);
+
+        if (hit.state == ghupdate::DiskCache::State::Stale && cache.try_claim_revalidation(key)) {
+            std::cout.flush();
+            try {
+                cache.store(key, ghupdate::check_github_update(options.repo, options.local).latestVersion);
+            } catch (const std::exception&) {
+                // The stale answer was already delivered; the next invocation retries
+            }
+            cache.release_revalidation(key);
+        }
+        return info.hasUpdate ? 2 : 0;
+    }
+
+    auto info = ghupdate::check_github_update(options.repo, options.local);
+    try {
+        cache.store(key, info.latestVersion);
+    } catch (const std::exception&) {
+        // An unwritable cache must not fail the check itself
+    }
+    print_result(options.local, info);
+    return info.hasUpdate ? 2 : 0;
+}
+
+/*!
+ * @struct Manifest
+ * @brief Repositories read from a manifest
+ */
+struct Manifest {
+    std::vector<ghupdate::RepoCheck> repos;                         ///< Repositories and local versions
+    std::vector<std::optional<std::chrono::seconds>> intervals;     ///< Per-repository watch interval, if given
+};
+
+/*!
+ * @brief Parses a manifest of repositories and local versions
+ *
+ * Accepts plain text with one "<repo> <local-version> [interval]" entry
+ * per line (blank lines and lines starting with '#' are ignored) or, if
+ * the first character is '[' or '{', JSON: an array of
+ * {"repo": ..., "version": ..., "interval": ...} objects ("interval"
+ * optional) or an object mapping repositories to versions.
+ *
+ * @throws std::runtime_error on malformed entries
+ */
+Manifest parse_manifest(std::string_view text) {
+    Manifest manifest;
+    auto add = [&](std::string repo, std::string version, std::optional<std::chrono::seconds> interval = {}) {
+        manifest.repos.push_back({std::move(repo), std::move(version)});
+        manifest.intervals.push_back(interval);
+    };
+
+    auto first = text.find_first_not_of(" \t\r\n");
+    if (first != std::string_view::npos && (text[first] == '[' || text[first] == '{')) {
+        nlohmann::json json = nlohmann::json::parse(text, nullptr, false);
+        if (json.is_discarded())
+            throw std::runtime_error("Invalid manifest: malformed JSON");
+
+        if (json.is_object()) {
+            for (const auto& [repo, version] : json.items()) {
+                if (!version.is_string())
+                    throw std::runtime_error("Invalid manifest: version of " + repo + " is not a string");
+                add(repo, version.get<std::string>());
+            }
+            return manifest;
+        }
+
+        for (const auto& item : json) {
+            auto repo = item.is_object() ? item.find("repo") : item.end();
+            auto version = item.is_object() ? item.find("version") : item.end();
+            if (repo == item.end() || version == item.end() || !repo->is_string() || !version->is_string())
+                throw std::runtime_error("Invalid manifest: entries need string \"repo\" and \"version\" fields");
+
+            std::optional<std::chrono::seconds> interval;
+            if (auto it = item.find("interval"); it != item.end()) {
+                if (!it->is_number_unsigned() || it->get<long long>() == 0)
+                    throw std::runtime_error("Invalid manifest: \"interval\" must be a positive number of seconds");
+                interval = std::chrono::seconds(it->get<long long>());
+            }
+            add(repo->get<std::string>(), version->get<std::string>(), interval);
+        }
+        return manifest;
+    }
+
+    std::istringstream lines{std::string(text)};
+    std::string line;
+    for (std::size_t number = 1; std::getline(lines, line); ++number) {
+        std::istringstream fields(line);
+        std::string repo, version, extra;
+        if (!(fields >> repo) || repo.starts_with('#'))
+            continue;
+
+        std::optional<std::chrono::seconds> interval;
+        bool valid = static_cast<bool>(fields >> version);
+        if (valid && (fields >> extra) && !extra.starts_with('#')) {
+            interval = parse_seconds(extra);
+            valid = interval && *interval > std::chrono::seconds(0) && (!(fields >> extra) || extra.starts_with('#'));
+        }
+        if (!valid)
+            throw std::runtime_error("Invalid manifest line " + std::to_string(number) +
+                                     ": expected '<repo> <local-version> [interval]'");
+        add(std::move(repo), std::move(version), interval);
+    }
+    return manifest;
+}
+
+/*!
+ * @class BufferedWriter
+ * @brief Thread-safe buffered stdout writer flushed by size or age
+ *
+ * Text is collected in memory and written with a single fwrite() once
+ * @p capacity bytes are pending or the oldest pending byte is @p interval
+ * old, so high-volume output needs few syscalls while a slow trickle of
+ * results still reaches the consumer promptly. Pending text is written on
+ * destruction.
+ */
+class BufferedWriter {
+public:
+    explicit BufferedWriter(std::FILE* out,
+                            std::chrono::milliseconds interval = std::chrono::milliseconds(50),
+                            std::size_t capacity = 64 * 1024)
+        : out_(out), interval_(interval), capacity_(capacity),
+          flusher_([this](std::stop_token stop) { run(stop); }) {}
+
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+    ~BufferedWriter() {
+        flusher_.request_stop();
+        flusher_.join();
+        flush_locked();
+    }
+
+    void write(std::string_view text) {
+        std::lock_guard lock(mutex_);
+        if (buffer_.empty()) {
+            pendingSince_ = std::chrono::steady_clock::now();
+            cv_.notify_one();
+        }
+        buffer_ += text;
+        if (buffer_.size() >= capacity_)
+            flush_locked();
+    }
+
+    void flush() {
+        std::lock_guard lock(mutex_);
+        flush_locked();
+    }
+
+private:
+    void run(std::stop_token stop) {
+        std::unique_lock lock(mutex_);
+        while (!stop.stop_requested()) {
+            if (buffer_.empty()) {
+                cv_.wait(lock, stop, [this] { return !buffer_.empty(); });
+                continue;
+            }
+            cv_.wait_until(lock, stop, pendingSince_ + interval_, [] { return false; });
+            if (std::chrono::steady_clock::now() >= pendingSince_ + interval_)
+                flush_locked();
+        }
+    }
+
+    void flush_locked() {
+        if (buffer_.empty())
+            return;
+        std::fwrite(buffer_.data(), 1, buffer_.size(), out_);
+        std::fflush(out_);
+        buffer_.clear();
+    }
+
+    std::FILE* out_;
+    std::chrono::milliseconds interval_;
+    std::size_t capacity_;
+    std::mutex mutex_;
+    std::condition_variable_any cv_;
+    std::string buffer_;
+    std::chrono::steady_clock::time_point pendingSince_{};
+    std::jthread flusher_;  // last: started once everything it uses exists
+};
+
+/*!
+ * @brief Quotes a CSV field if it contains separators, quotes or line breaks
+ */
+std::string csv_field(std::string_view text) {
+    if (text.find_first_of(",\"\r\n") == std::string_view::npos)
+        return std::string(text);
+    std::string quoted = "\"";
+    for (char c : text) {
+        if (c == '"')
+            quoted += '"';
+        quoted += c;
+    }
+    return quoted + '"';
+}
+
+/*!
+ * @class RecordPrinter
+ * @brief Formats one result record per repository in the selected format
+ *
+ * begin() and end() write the framing of the format (CSV header, JSON
+ * array brackets); record() must not be called concurrently.
+ */
+class RecordPrinter {
+public:
+    RecordPrinter(OutputFormat format, BufferedWriter& out) : format_(format), out_(out) {}
+
+    void begin() {
+        if (format_ == OutputFormat::Json)
+            out_.write("[");
+        else if (format_ == OutputFormat::Csv)
+            out_.write("repo,local_version,latest_version,update,error,latency_ms,cache_hit\n");
+    }
+
+    void record(const ghupdate::RepoCheck& entry, const ghupdate::CheckResult& result,
+                std::chrono::steady_clock::duration latency, bool cacheHit) {
+        // Milliseconds with microsecond resolution
+        double latencyMs = std::round(std::chrono::duration<double, std::micro>(latency).count()) / 1000;
+
+        std::string line;
+        switch (format_) {
+        case OutputFormat::Text:
+            if (!result)
+                line = "ERROR   " + entry.repoUrl + " " + result.error();
+            else if (result->hasUpdate)
+                line = "UPDATE  " + entry.repoUrl + " " + entry.localVersion + " -> " + result->latestVersion;
+            else
+                line = "OK      " + entry.repoUrl + " " + entry.localVersion;
+            break;
+        case OutputFormat::Json:
+        case OutputFormat::Ndjson: {
+            nlohmann::ordered_json json{
+                {"repo", entry.repoUrl},
+                {"local_version", entry.localVersion},
+                {"latest_version", result ? nlohmann::ordered_json(result->latestVersion) : nullptr},
+                {"update", result ? nlohmann::ordered_json(result->hasUpdate) : nullptr},
+                {"error", result ? nullptr : nlohmann::ordered_json(result.error())},
+                {"latency_ms", latencyMs},
+                {"cache_hit", cacheHit},
+            };
+            line = json.dump();
+            if (format_ == OutputFormat::Json)
+                line = (first_ ? "\n" : ",\n") + line;
+            break;
+        }
+        case OutputFormat::Csv: {
+            char ms[32];
+            auto [msEnd, ec] = std::to_chars(ms, ms + sizeof ms, latencyMs);
+            line = csv_field(entry.repoUrl) + ',' + csv_field(entry.localVersion) + ',' +
+                   (result ? csv_field(result->latestVersion) + ',' + (result->hasUpdate ? "true" : "false") + ','
+                           : ",," + csv_field(result.error())) +
+                   ',' + std::string(ms, ec == std::errc{} ? msEnd : ms) + ',' + (cacheHit ? "true" : "false");
+            break;
+        }
+        }
+        first_ = false;
+        if (format_ != OutputFormat::Json)
+            line += '\n';
+        out_.write(line);
+    }
+
+    void end() {
+        if (format_ == OutputFormat::Json)
+            out_.write(first_ ? "]\n" : "\n]\n");
+    }
+
+private:
+    OutputFormat format_;
+    BufferedWriter& out_;
+    bool first_ = true;
+};
+
+/*!
+ * @brief Reads and parses the manifest named by --manifest ("-" for stdin)
+ */
+Manifest read_manifest(const std::string& path) {
+    std::string text;
+    if (path == "-") {
+        text.assign(std::istreambuf_iterator<char>(std::cin), {});
+    } else {
+        std::ifstream in(path, std::ios::binary);
+        if (!in)
+            throw std::runtime_error("Cannot open manifest: " + path);
+        text.assign(std::istreambuf_iterator<char>(in), {});
+    }
+    return parse_manifest(text);
+}
+
+/*!
+ * @brief Checks a list of repositories concurrently, streaming one record each
+ *
+ * Entries are checked by check_github_updates() with --jobs workers and
+ * one shared rate limit scheduler; each result is printed as soon as it
+ * completes. With --cache-ttl, fresh and stale cache entries are printed
+ * immediately and only misses (and claimed revalidations) hit the network.
+ *
+ * @return Process exit code
+ */
+int run_checks(const CliOptions& options, std::span<const ghupdate::RepoCheck> entries) {
+    BufferedWriter out(stdout);
+    RecordPrinter printer(options.format, out);
+    ghupdate::MetricsRegistry registry;
+
+    bool anyUpdate = false;
+    bool anyError = false;
+    auto report = [&](const ghupdate::RepoCheck& entry, const ghupdate::CheckResult& result,
+                      std::chrono::steady_clock::duration latency, bool cacheHit) {
+        anyError |= !result.has_value();
+        anyUpdate |= result && result->hasUpdate;
+        printer.record(entry, result, latency, cacheHit);
+    };
+
+    std::optional<ghupdate::DiskCache> cache;
+    if (options.cacheTtl) {
+        cache.emplace(options.cacheDir.empty() ? ghupdate::DiskCache::default_directory() : options.cacheDir,
+                      *options.cacheTtl, options.staleWhileRevalidate);
+    }
+
+    printer.begin();
+
+    // Entries that need a network check, with their cache key and whether
+    // the result still has to be printed (false for background revalidation)
+    std::vector<ghupdate::RepoCheck> pending;
+    std::vector<std::string> pendingKeys;
+    std::vector<bool> pendingReport;
+    for (const auto& entry : entries) {
+        if (!cache) {
+            pending.push_back(entry);
+            pendingKeys.emplace_back();
+            pendingReport.push_back(true);
+            continue;
+        }
+
+        const auto started = std::chrono::steady_clock::now();
+        std::string key;
+        ghupdate::DiskCache::Lookup hit;
+        try {
+            key = ghupdate::github_repo_slug(entry.repoUrl);
+            hit = cache->lookup(key);
+            if (hit.state != ghupdate::DiskCache::State::Miss) {
+                registry.cacheHits.inc();
+                ghupdate::UpdateInfo info{
+                    ghupdate::SemVer::parse(hit.latestVersion) > ghupdate::SemVer::parse(entry.localVersion),
+                    hit.latestVersion};
+                report(entry, info, std::chrono::steady_clock::now() - started, true);
+            }
+        } catch (const std::exception& e) {
+            report(entry, std::unexpected(std::string(e.what())), std::chrono::steady_clock::now() - started, false);
+            continue;
+        }
+
+        if (hit.state == ghupdate::DiskCache::State::Fresh ||
+            (hit.state == ghupdate::DiskCache::State::Stale && !cache->try_claim_revalidation(key)))
+            continue;
+        pending.push_back(entry);
+        pendingKeys.push_back(std::move(key));
+        pendingReport.push_back(hit.state == ghupdate::DiskCache::State::Miss);
+    }
+
+    ghupdate::RateLimitScheduler scheduler;
+    ghupdate::BatchMetrics metrics;
+    ghupdate::BatchOptions batch{.concurrency = options.jobs,
+                                 .check = {.scheduler = &scheduler,
+                                           .collectMetrics = options.timings,
+                                           .metrics = &registry}};
+    batch.onComplete = [&](std::size_t i, const ghupdate::CheckResult& result,
+                           std::chrono::steady_clock::duration elapsed) {
+        if (options.timings)
+            metrics.add(result);
+        if (cache) {
+            try {
+                if (result)
+                    cache->store(pendingKeys[i], result->latestVersion);
+            } catch (const std::exception&) {
+                // An unwritable cache must not fail the check itself
+            }
+            if (!pendingReport[i])
+                cache->release_revalidation(pendingKeys[i]);
+        }
+        if (pendingReport[i])
+            report(pending[i], result, elapsed, false);
+    };
+    ghupdate::check_github_updates(pending, batch);
+
+    printer.end();
+    if (options.timings && !pending.empty()) {
+        out.flush();
+        std::cerr << metrics.summary();
+    }
+    if (!options.metricsFile.empty())
+        registry.write_textfile(options.metricsFile);
+    return anyError ? 3 : anyUpdate ? 2 : 0;
+}
+
+/// Set by SIGINT / SIGTERM to end watch mode
+volatile std::sig_atomic_t interrupted = 0;
+
+/*!
+ * @brief Watches repositories until interrupted, printing changed results
+ *
+ * All repositories are scheduled on one ghupdate::Watcher with --jobs
+ * workers, their own or the default --interval and a shared rate limit
+ * scheduler. A record is printed for the first result of each repository
+ * and whenever its latest version or update state changes.
+ *
+ * @return Process exit code
+ */
+int run_watch(const CliOptions& options, const Manifest& manifest) {
+    ghupdate::MetricsRegistry registry;
+#if !defined(_WIN32)
+    std::optional<ghupdate::MetricsServer> server;
+    if (options.metricsPort)
+        server.emplace(registry, options.metricsHost, *options.metricsPort);
+#else
+    if (options.metricsPort)
+        throw std::runtime_error("--metrics-listen is not supported on this platform");
+#endif
+
+    ghupdate::RateLimitScheduler scheduler;
+    ghupdate::Watcher watcher({.concurrency = options.jobs,
+                               .check = {.scheduler = &scheduler, .metrics = &registry}});
+    for (std::size_t i = 0; i < manifest.repos.size(); ++i)
+        watcher.add(manifest.repos[i], manifest.intervals[i].value_or(options.interval));
+
+    BufferedWriter out(stdout);
+    RecordPrinter printer(options.format, out);
+    printer.begin();
+
+    // Signal handlers may only set a flag; a helper thread turns it into a stop request
+    std::signal(SIGINT, [](int) { interrupted = 1; });
+    std::signal(SIGTERM, [](int) { interrupted = 1; });
+    std::stop_source stop;
+    auto writeMetrics = [&] {
+        if (options.metricsFile.empty())
+            return;
+        try {
+            registry.write_textfile(options.metricsFile);
+        } catch (const std::exception& e) {
+            std::cerr << "Warning: " << e.what() << "\n";
+        }
+    };
+    std::jthread signalWatch([&](std::stop_token own) {
+        auto nextWrite = std::chrono::steady_clock::now();
+        while (!interrupted && !own.stop_requested()) {
+            if (std::chrono::steady_clock::now() >= nextWrite) {
+                writeMetrics();
+                nextWrite += std::chrono::seconds(15);
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        stop.request_stop();
+    });
+
+    watcher.run(stop.get_token(), [&](const ghupdate::WatchEvent& event) {
+        printer.record(event.repo, event.result, event.elapsed, false);
+    });
+
+    printer.end();
+    writeMetrics();
+    return 0;
+}
+
+} // namespace
 
 /*!
  * @brief Main entry point for the GitHub update checker CLI
@@ -63,29 +814,38 @@
  * @return Exit code:
  *         - 0: No update available
  *         - 1: Invalid arguments (usage error)
- *         - 2: Update available
- *         - 3: Runtime error (network, API, parsing)
+ *         - 2: Update available (in manifest mode: for any entry)
+ *         - 3: Runtime error (network, API, parsing; in manifest mode: for any entry)
  *
  * @note Catches std::exception and reports error to stderr
  */
 int main(int argc, char** argv) {
-    if (argc < 3) {
-        std::cerr << "Usage: gh-update-checker <repo-api-url> <local-version>\n";
-        std::cerr << "Example:\n";
-        std::cerr << "  gh-update-checker "
-                     "https://api.github.com/repos/nlohmann/json/releases/latest 3.11.2\n";
+    auto options = parse_args(argc, argv);
+    if (!options) {
+        print_usage();
         return 1;
     }
 
-    std::string repo = argv[1];
-    std::string local = argv[2];
-
     try {
-        auto info = ghupdate::check_github_update(repo, local);
+        if (options->watch) {
+            Manifest manifest = options->manifest.empty()
+                ? Manifest{{{options->repo, options->local}}, {std::nullopt}}
+                : read_manifest(options->manifest);
+            return run_watch(*options, manifest);
+        }
+        if (!options->manifest.empty()) {
+            Manifest manifest = read_manifest(options->manifest);
+            return run_checks(*options, manifest.repos);
+        }
+        if (options->format != OutputFormat::Text) {
+            const ghupdate::RepoCheck entry{options->repo, options->local};
+            return run_checks(*options, std::span(&entry, 1));
+        }
+        if (options->cacheTtl)
+            return run_cached(*options);
 
-        std::cout << "Local version:  " << local << "\n";
-        std::cout << "Remote version: " << info.latestVersion << "\n";
-        std::cout << "Update:         " << (info.hasUpdate ? "YES" : "NO") << "\n";
+        auto info = ghupdate::check_github_update(options->repo, options->local);
+        print_result(options->local, info);
 
         return info.hasUpdate ? 2 : 0;  
         // exit code 2 = update available
@@ -7,10 +7,14 @@
  * 
  * Features:
  *  - HTTP GET requests via libcurl
- *  - JSON parsing with nlohmann/json
+ *  - Streaming extraction of tag_name without building a JSON DOM
  *  - Semantic versioning (SemVer) parsing and comparison
  *  - Automatic GitHub URL to API URL conversion
  *  - Synchronous and asynchronous version checking
+ *  - Batch checking over a bounded worker pool
+ *  - Reusable Client with keep-alive and shared DNS/TLS session cache
+ *  - Conditional requests (ETag / Last-Modified) via a persistent ValidatorStore
+ *  - Pluggable Transport for embedders with their own HTTP stack
  *  - Exception-based error handling for invalid inputs
  *
  * @author Your Team
@@ -36,11 +40,37 @@
 #pragma once
 #include <string>
 #include <string_view>
-#include <regex>
 #include <stdexcept>
+#include <limits>
+#include <compare>
+#include <cstdint>
 #include <future>
+#include <vector>
+#include <span>
+#include <thread>
+#include <atomic>
+#include <expected>
+#include <algorithm>
+#include <functional>
+#include <array>
+#include <memory>
+#include <optional>
+#include <chrono>
+#include <charconv>
+#include <random>
+#include <mutex>
+#include <condition_variable>
+#include <stop_token>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <curl/curl.h>
 #include <nlohmann/json.hpp>
+#include <ghupdate/validator_store.hpp>
+#include <ghupdate/rate_limit.hpp>
+#include <ghupdate/metrics_registry.hpp>
+#include <ghupdate/release_tag_extractor.hpp>
 
 namespace ghupdate {
 
@@ -48,63 +78,449 @@ namespace ghupdate {
 // SemVer
 // ---------------------------------------------------------
 
+namespace detail {
+
+constexpr bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+/*!
+ * @brief Returns the end of the run of digits starting at @p pos
+ */
+constexpr std::size_t digits_end(std::string_view v, std::size_t pos) {
+    while (pos < v.size() && is_digit(v[pos]))
+        ++pos;
+    return pos;
+}
+
+/*!
+ * @brief Converts a non-empty run of decimal digits to int
+ * @throws std::out_of_range if the value does not fit into int (like std::stoi)
+ */
+constexpr int digits_to_int(std::string_view digits) {
+    long long value = 0;
+    for (char c : digits) {
+        value = value * 10 + (c - '0');
+        if (value > std::numeric_limits<int>::max())
+            throw std::out_of_range("SemVer component out of range: " + std::string(digits));
+    }
+    return static_cast<int>(value);
+}
+
+} // namespace detail
+
 /*!
  * @struct SemVer
- * @brief Semantic versioning structure (major.minor.patch)
+ * @brief Semantic versioning structure (major.minor.patch[-pre-release][+build])
  *
  * Represents a semantic version following the pattern MAJOR.MINOR.PATCH.
- * Supports version strings with optional 'v' prefix (e.g., "v1.2.3" or "1.2.3").
- * 
- * @note Implements three-way comparison operator (operator<=>)
- *       for easy version comparison (>, <, ==, etc.)
+ * Supports version strings with optional 'v' prefix (e.g., "v1.2.3" or "1.2.3"),
+ * SemVer 2.0.0 pre-release identifiers ("1.2.0-rc.1") and build metadata
+ * ("1.2.0+20240101").
+ *
+ * Pre-release and build metadata of up to kSuffixCapacity characters are
+ * stored inline (no heap allocation), so SemVer stays usable in constant
+ * expressions. Longer suffixes are valid SemVer too and move to the heap.
+ *
+ * @note Implements three-way comparison operator (operator<=>) with the
+ *       SemVer 2.0.0 precedence rules: a pre-release has lower precedence
+ *       than the associated normal version, and build metadata is ignored.
+ *       The common cases (no pre-release, or a differing leading
+ *       identifier) are decided by integer comparisons only.
  */
 struct SemVer {
     int major = 0;  ///< Major version component
     int minor = 0;  ///< Minor version component
     int patch = 0;  ///< Patch version component
 
+    /// Maximum combined length of pre-release and build metadata stored inline
+    static constexpr std::size_t kSuffixCapacity = 48;
+
+    constexpr SemVer() = default;
+
+    /*!
+     * @brief Creates a normal (non pre-release) version
+     */
+    constexpr SemVer(int major_, int minor_ = 0, int patch_ = 0)
+        : major(major_), minor(minor_), patch(patch_) {}
+
+    constexpr SemVer(const SemVer& other) { assign(other, other.heap_ ? clone(other) : nullptr); }
+
+    constexpr SemVer(SemVer&& other) noexcept {
+        assign(other, other.heap_);
+        other.release_heap();
+    }
+
+    constexpr SemVer& operator=(const SemVer& other) {
+        if (this != &other) {
+            char* heap = other.heap_ ? clone(other) : nullptr;
+            delete[] heap_;
+            assign(other, heap);
+        }
+        return *this;
+    }
+
+    constexpr SemVer& operator=(SemVer&& other) noexcept {
+        if (this != &other) {
+            if (heap_) [[unlikely]]
+                delete[] heap_;
+            assign(other, other.heap_);
+            other.release_heap();
+        }
+        return *this;
+    }
+
+    constexpr ~SemVer() { delete[] heap_; }
+
+    /*!
+     * @brief Dot-separated pre-release identifiers (e.g. "rc.1"), empty if none
+     */
+    constexpr std::string_view prerelease() const {
+        return std::string_view(suffix(), preLen_);
+    }
+
+    /*!
+     * @brief Build metadata (e.g. "20240101.sha"), empty if none
+     */
+    constexpr std::string_view build() const {
+        return std::string_view(suffix() + preLen_, buildLen_);
+    }
+
+    /*!
+     * @brief true if this version carries pre-release identifiers
+     */
+    constexpr bool is_prerelease() const { return preLen_ != 0; }
+
     /*!
      * @brief Parses a semantic version string
      *
      * Extracts major, minor, and patch components from a string.
-     * Accepts formats: "1.2.3", "v1.2.3", "1.2"
+     * Accepts formats: "1.2.3", "v1.2.3", "1.2", "1.2.3-rc.1", "1.2.3+build"
+     *
+     * The first "<digits>.<digits>[.<digits>]" sequence found anywhere in
+     * the string is used, so tags such as "release-1.2.3" are accepted. It
+     * may be followed by "-<pre-release>" and/or "+<build>", each a
+     * dot-separated list of [0-9A-Za-z-] identifiers; anything after that is
+     * ignored. The parser is hand-written, performs no heap allocation on
+     * success and is usable in constant expressions.
      *
      * @param v Version string to parse
      * @return Parsed SemVer structure
      * @throws std::runtime_error if version format is invalid
+     * @throws std::out_of_range if a component does not fit into int
      *
      * @example
      * ```cpp
-     * auto ver = SemVer::parse("v3.11.2");  // major=3, minor=11, patch=2
-     * auto ver = SemVer::parse("1.0");      // major=1, minor=0, patch=0
+     * auto ver = SemVer::parse("v3.11.2");     // major=3, minor=11, patch=2
+     * auto ver = SemVer::parse("1.0");         // major=1, minor=0, patch=0
+     * auto ver = SemVer::parse("2.0.0-rc.1");  // prerelease()=="rc.1"
      * ```
      */
-    static SemVer parse(std::string_view v) {
-        std::regex re(R"(v?(\d+)\.(\d+)(?:\.(\d+))?)");
-        std::cmatch m;
-
-        if (!std::regex_search(v.begin(), v.end(), m, re))
+    static constexpr SemVer parse(std::string_view v) {
+        SemVer sv;
+        if (!sv.parse_from(v))
             throw std::runtime_error("Invalid SemVer: " + std::string(v));
+        return sv;
+    }
 
-        SemVer sv;
-        sv.major = std::stoi(m[1]);
-        sv.minor = std::stoi(m[2]);
-        sv.patch = m[3].matched ? std::stoi(m[3]) : 0;
+    /*!
+     * @brief Parses a semantic version string without throwing on mismatch
+     *
+     * Same rules as parse(), but a string that contains no version yields
+     * std::nullopt instead of an exception. Useful when scanning many
+     * candidates (e.g. all tags of a repository) of which some are not
+     * versions.
+     *
+     * @param v Version string to parse
+     * @return Parsed SemVer, or std::nullopt if @p v contains no version
+     * @throws std::out_of_range if a component does not fit into int
+     */
+    static constexpr std::optional<SemVer> try_parse(std::string_view v) {
+        std::optional<SemVer> sv(std::in_place);
+        if (!sv->parse_from(v))
+            sv.reset();
         return sv;
     }
 
+    /*!
+     * @brief Formats the version as "major.minor.patch[-pre][+build]"
+     */
+    std::string to_string() const {
+        std::string out = std::to_string(major) + "." + std::to_string(minor) + "." + std::to_string(patch);
+        if (preLen_) {
+            out += '-';
+            out += prerelease();
+        }
+        if (buildLen_) {
+            out += '+';
+            out += build();
+        }
+        return out;
+    }
+
     /*!
      * @brief Three-way comparison operator for semantic version comparison
-     * @return Comparison result (==, <, >)
+     * @return Comparison result (==, <, >) following SemVer 2.0.0 precedence
      * @note Enables use with <, >, <=, >= operators
      */
-    auto operator<=>(const SemVer&) const = default;
+    constexpr std::strong_ordering operator<=>(const SemVer& other) const {
+        if (auto c = major <=> other.major; c != 0) return c;
+        if (auto c = minor <=> other.minor; c != 0) return c;
+        if (auto c = patch <=> other.patch; c != 0) return c;
+        if (auto c = preKey_ <=> other.preKey_; c != 0) return c;
+        if (preKey_ == kReleaseKey)
+            return std::strong_ordering::equal;
+        return compare_prerelease(prerelease(), other.prerelease());
+    }
+
+    /*!
+     * @brief Equality by precedence (build metadata is ignored)
+     */
+    constexpr bool operator==(const SemVer& other) const {
+        return (*this <=> other) == 0;
+    }
+
+private:
+    /// Packed key of a version without pre-release (sorts above every pre-release)
+    static constexpr std::uint32_t kReleaseKey = 0xFFFFFFFF;
+    /// Largest numeric identifier represented exactly in the packed key
+    static constexpr std::uint32_t kMaxNumericKey = 0x7FFFFFFE;
+
+    static constexpr bool is_ident_char(char c) {
+        return detail::is_digit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '-';
+    }
+
+    /*!
+     * @brief Returns the end of the dot-separated identifier list at @p pos
+     *
+     * Stops before an empty identifier, so a trailing '.' is not included.
+     */
+    static constexpr std::size_t identifiers_end(std::string_view v, std::size_t pos) {
+        std::size_t end = pos;
+        std::size_t i = pos;
+        while (i < v.size()) {
+            std::size_t start = i;
+            while (i < v.size() && is_ident_char(v[i]))
+                ++i;
+            if (i == start)
+                break;
+            end = i;
+            if (i >= v.size() || v[i] != '.')
+                break;
+            ++i;
+        }
+        return end;
+    }
+
+    static constexpr bool is_numeric(std::string_view id) {
+        for (char c : id)
+            if (!detail::is_digit(c)) return false;
+        return !id.empty();
+    }
+
+    /*!
+     * @brief Compares two numeric identifiers of any length without overflow
+     */
+    static constexpr std::strong_ordering compare_numeric(std::string_view a, std::string_view b) {
+        while (a.size() > 1 && a.front() == '0') a.remove_prefix(1);
+        while (b.size() > 1 && b.front() == '0') b.remove_prefix(1);
+        if (auto c = a.size() <=> b.size(); c != 0) return c;
+        return a.compare(b) <=> 0;
+    }
+
+    /*!
+     * @brief Full SemVer 2.0.0 precedence comparison of pre-release strings
+     */
+    static constexpr std::strong_ordering compare_prerelease(std::string_view a, std::string_view b) {
+        while (!a.empty() && !b.empty()) {
+            std::size_t ea = a.find('.');
+            std::size_t eb = b.find('.');
+            std::string_view ia = a.substr(0, ea);
+            std::string_view ib = b.substr(0, eb);
+
+            bool na = is_numeric(ia);
+            bool nb = is_numeric(ib);
+            std::strong_ordering c = std::strong_ordering::equal;
+            if (na && nb)
+                c = compare_numeric(ia, ib);
+            else if (na != nb)
+                c = na ? std::strong_ordering::less : std::strong_ordering::greater;
+            else
+                c = ia.compare(ib) <=> 0;
+            if (c != 0)
+                return c;
+
+            a = ea == std::string_view::npos ? std::string_view{} : a.substr(ea + 1);
+            b = eb == std::string_view::npos ? std::string_view{} : b.substr(eb + 1);
+        }
+        return a.size() <=> b.size();
+    }
+
+    /*!
+     * @brief Order-preserving integer key of the first pre-release identifier
+     *
+     * Numeric identifiers map to their value, alphanumeric ones to
+     * 0x80000000 plus their first three characters, so numeric < alphanumeric
+     * as required by SemVer. Equal keys fall back to compare_prerelease().
+     */
+    static constexpr std::uint32_t prerelease_key(std::string_view pre) {
+        std::string_view first = pre.substr(0, pre.find('.'));
+        if (is_numeric(first)) {
+            std::uint64_t value = 0;
+            for (char c : first) {
+                value = value * 10 + static_cast<std::uint64_t>(c - '0');
+                if (value > kMaxNumericKey) return kMaxNumericKey + 1;
+            }
+            return static_cast<std::uint32_t>(value);
+        }
+        std::uint32_t key = 0;
+        for (std::size_t i = 0; i < 3; ++i)
+            key = (key << 8) | (i < first.size() ? static_cast<std::uint8_t>(first[i]) : 0u);
+        return 0x80000000u | key;
+    }
+
+    /*!
+     * @brief Parses @p v into this default-constructed version
+     * @return false if @p v contains no version
+     */
+    constexpr bool parse_from(std::string_view v) {
+        std::size_t pos = 0;
+        while (pos < v.size()) {
+            if (!detail::is_digit(v[pos])) {
+                ++pos;
+                continue;
+            }
+
+            std::size_t majorEnd = detail::digits_end(v, pos);
+            if (majorEnd + 1 < v.size() && v[majorEnd] == '.' && detail::is_digit(v[majorEnd + 1])) {
+                std::size_t minorEnd = detail::digits_end(v, majorEnd + 1);
+                std::size_t end = minorEnd;
+
+                major = detail::digits_to_int(v.substr(pos, majorEnd - pos));
+                minor = detail::digits_to_int(v.substr(majorEnd + 1, minorEnd - majorEnd - 1));
+                if (minorEnd + 1 < v.size() && v[minorEnd] == '.' && detail::is_digit(v[minorEnd + 1])) {
+                    end = detail::digits_end(v, minorEnd + 1);
+                    patch = detail::digits_to_int(v.substr(minorEnd + 1, end - minorEnd - 1));
+                }
+                parse_suffix(v, end);
+                return true;
+            }
+            pos = majorEnd;
+        }
+        return false;
+    }
+
+    constexpr void parse_suffix(std::string_view v, std::size_t pos) {
+        std::string_view pre;
+        std::string_view build;
+        if (pos + 1 < v.size() && v[pos] == '-') {
+            std::size_t end = identifiers_end(v, pos + 1);
+            pre = v.substr(pos + 1, end - (pos + 1));
+            if (!pre.empty())
+                pos = end;
+        }
+        if (pos + 1 < v.size() && v[pos] == '+') {
+            std::size_t end = identifiers_end(v, pos + 1);
+            build = v.substr(pos + 1, end - (pos + 1));
+        }
+
+        char* out = suffix_.data();
+        if (pre.size() + build.size() > kSuffixCapacity) [[unlikely]]
+            out = heap_ = allocate(pre.size() + build.size());
+        for (char c : pre)
+            *out++ = c;
+        for (char c : build)
+            *out++ = c;
+        preLen_ = static_cast<std::uint32_t>(pre.size());
+        buildLen_ = static_cast<std::uint32_t>(build.size());
+        if (!pre.empty())
+            preKey_ = prerelease_key(pre);
+    }
+
+    constexpr const char* suffix() const { return heap_ ? heap_ : suffix_.data(); }
+
+    // Out of line, so the allocation does not stop parse() from being inlined
+    [[gnu::noinline]] static constexpr char* allocate(std::size_t size) { return new char[size]; }
+
+    static constexpr char* clone(const SemVer& other) {
+        std::size_t len = std::size_t{other.preLen_} + other.buildLen_;
+        char* heap = allocate(len);
+        for (std::size_t i = 0; i < len; ++i)
+            heap[i] = other.heap_[i];
+        return heap;
+    }
+
+    // Drops the heap buffer after it was moved out; without it the lengths no
+    // longer describe readable storage, so the version becomes a plain release
+    constexpr void release_heap() noexcept {
+        if (heap_) {
+            heap_ = nullptr;
+            preKey_ = kReleaseKey;
+            preLen_ = 0;
+            buildLen_ = 0;
+        }
+    }
+
+    // Copies everything but the heap buffer, which the caller provides
+    constexpr void assign(const SemVer& other, char* heap) {
+        major = other.major;
+        minor = other.minor;
+        patch = other.patch;
+        suffix_ = other.suffix_;
+        preKey_ = other.preKey_;
+        preLen_ = other.preLen_;
+        buildLen_ = other.buildLen_;
+        heap_ = heap;
+    }
+
+    std::array<char, kSuffixCapacity> suffix_{};  ///< Pre-release followed by build metadata, if they fit
+    char* heap_ = nullptr;                        ///< Pre-release and build metadata beyond kSuffixCapacity
+    std::uint32_t preKey_ = kReleaseKey;          ///< Packed precedence of the pre-release
+    std::uint32_t preLen_ = 0;                    ///< Length of the pre-release
+    std::uint32_t buildLen_ = 0;                  ///< Length of the build metadata
 };
 
+namespace literals {
+
+/*!
+ * @brief Compile-time SemVer literal
+ *
+ * Invalid versions are rejected at compile time.
+ *
+ * @example
+ * ```cpp
+ * using namespace ghupdate::literals;
+ * constexpr auto minimum = "2.1.0"_semver;
+ * static_assert(minimum.minor == 1);
+ * ```
+ */
+consteval SemVer operator""_semver(const char* str, std::size_t len) {
+    return SemVer::parse(std::string_view(str, len));
+}
+
+} // namespace literals
+
 // ---------------------------------------------------------
 // HTTP GET via curl
 // ---------------------------------------------------------
 
+namespace detail {
+
+/*!
+ * @brief Initializes libcurl globally exactly once
+ *
+ * curl_global_init() is not thread-safe on older libcurl versions and is
+ * implicitly invoked by the first curl_easy_init(). Calling this before
+ * creating handles avoids a race when checks start on several threads.
+ */
+inline void ensure_curl_initialized() {
+    static const CURLcode rc = curl_global_init(CURL_GLOBAL_DEFAULT);
+    if (rc != CURLE_OK)
+        throw std::runtime_error("curl global init failed");
+}
+
+} // namespace detail
+
 /*!
  * @brief CURL write callback for HTTP response buffering
  *
@@ -119,12 +535,248 @@ struct SemVer {
  *
  * @note This is an internal implementation detail for use with curl_easy_setopt
  */
-static size_t write_callback(void* contents, size_t size, size_t nmemb, void* userp) {
+static size_t write_callback(char* contents, size_t size, size_t nmemb, void* userp) {
     size_t total = size * nmemb;
-    static_cast<std::string*>(userp)->append((char*)contents, total);
+    static_cast<std::string*>(userp)->append(contents, total);
     return total;
 }
 
+/// User-Agent sent with every request; GitHub rejects requests without one
+inline constexpr const char* kUserAgent = "C++23-gh-update-checker";
+
+namespace detail {
+
+/// Default limit for establishing a connection (including TLS handshake)
+inline constexpr std::chrono::milliseconds kDefaultConnectTimeout{10'000};
+/// Default limit for a complete request
+inline constexpr std::chrono::milliseconds kDefaultTransferTimeout{30'000};
+
+/*!
+ * @struct Timeouts
+ * @brief Connect and transfer limits of one request
+ *
+ * A transfer limit of 0 disables it; a connect limit of 0 selects curl's
+ * built-in default of 300 s.
+ */
+struct Timeouts {
+    std::chrono::milliseconds connect = kDefaultConnectTimeout;
+    std::chrono::milliseconds transfer = kDefaultTransferTimeout;
+};
+
+/*!
+ * @brief Applies the common GET options to an easy handle
+ *
+ * Shared by http_get() and the curl_multi based engine so that every
+ * transport sends identical requests.
+ *
+ * @param curl Easy handle to configure
+ * @param url The URL to request
+ * @param buffer Destination for the response body
+ * @param timeouts Connect and transfer limits
+ */
+inline void configure_get(CURL* curl, std::string_view url, std::string* buffer,
+                          const Timeouts& timeouts = {}) {
+    curl_easy_setopt(curl, CURLOPT_URL, std::string(url).c_str());
+    curl_easy_setopt(curl, CURLOPT_USERAGENT, kUserAgent);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, buffer);
+    curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT_MS, static_cast<long>(timeouts.connect.count()));
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, static_cast<long>(timeouts.transfer.count()));
+    curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+}
+
+} // namespace detail
+
+/*!
+ * @struct HttpResponse
+ * @brief Status, body and the response headers the checker cares about
+ */
+struct HttpResponse {
+    long status = 0;             ///< HTTP status code (e.g. 200, 304)
+    std::string body;            ///< Response body (empty for 304)
+    std::string etag;            ///< ETag header, if present
+    std::string lastModified;    ///< Last-Modified header, if present
+    RateLimit rateLimit;         ///< X-RateLimit-Remaining / -Reset and Retry-After, if present
+};
+
+namespace detail {
+
+/*!
+ * @brief Case-insensitive check whether a header line starts with a name
+ */
+inline bool header_is(std::string_view line, std::string_view name) {
+    if (line.size() <= name.size() || line[name.size()] != ':')
+        return false;
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        char a = line[i];
+        char b = name[i];
+        if (a >= 'A' && a <= 'Z') a = static_cast<char>(a - 'A' + 'a');
+        if (b >= 'A' && b <= 'Z') b = static_cast<char>(b - 'A' + 'a');
+        if (a != b) return false;
+    }
+    return true;
+}
+
+/*!
+ * @brief Returns the trimmed value of a "Name: value" header line
+ */
+inline std::string header_value(std::string_view line) {
+    line.remove_prefix(line.find(':') + 1);
+    while (!line.empty() && (line.front() == ' ' || line.front() == '\t'))
+        line.remove_prefix(1);
+    while (!line.empty() && (line.back() == '\r' || line.back() == '\n' || line.back() == ' '))
+        line.remove_suffix(1);
+    return std::string(line);
+}
+
+/*!
+ * @brief Parses a non-negative decimal header value
+ */
+inline std::optional<long long> header_number(std::string_view value) {
+    long long number = 0;
+    auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), number);
+    if (ec != std::errc{} || end != value.data() + value.size() || number < 0)
+        return std::nullopt;
+    return number;
+}
+
+/*!
+ * @brief Parses Retry-After, given either as delay-seconds or as HTTP-date
+ */
+inline std::optional<std::chrono::seconds> retry_after(const std::string& value) {
+    if (auto seconds = header_number(value))
+        return std::chrono::seconds(*seconds);
+    time_t date = curl_getdate(value.c_str(), nullptr);
+    if (date < 0)
+        return std::nullopt;
+    auto delay = std::chrono::system_clock::from_time_t(date) - std::chrono::system_clock::now();
+    return std::max(std::chrono::duration_cast<std::chrono::seconds>(delay), std::chrono::seconds(0));
+}
+
+} // namespace detail
+
+/*!
+ * @brief Fills the header fields of an HttpResponse from one header line
+ *
+ * Recognises ETag, Last-Modified, X-RateLimit-Remaining, X-RateLimit-Reset
+ * and Retry-After (names are case-insensitive); other lines are ignored. A
+ * status line ("HTTP/...") resets the fields, so that only the headers of
+ * the final response after redirects are kept. Custom Transport
+ * implementations can feed their header lines through this function.
+ *
+ * @param line Header line "Name: value", with or without the trailing CRLF
+ * @param response Response to update
+ */
+inline void parse_response_header(std::string_view line, HttpResponse& response) {
+    using namespace detail;
+    if (line.starts_with("HTTP/")) {
+        response.etag.clear();
+        response.lastModified.clear();
+        response.rateLimit = {};
+    } else if (header_is(line, "etag")) {
+        response.etag = header_value(line);
+    } else if (header_is(line, "last-modified")) {
+        response.lastModified = header_value(line);
+    } else if (header_is(line, "x-ratelimit-remaining")) {
+        if (auto remaining = header_number(header_value(line)))
+            response.rateLimit.remaining = static_cast<long>(*remaining);
+    } else if (header_is(line, "x-ratelimit-reset")) {
+        if (auto reset = header_number(header_value(line)))
+            response.rateLimit.reset = std::chrono::system_clock::time_point(std::chrono::seconds(*reset));
+    } else if (header_is(line, "retry-after")) {
+        response.rateLimit.retryAfter = retry_after(header_value(line));
+    }
+}
+
+namespace detail {
+
+/*!
+ * @brief CURL header callback filling the header fields of an HttpResponse
+ */
+inline size_t header_callback(char* data, size_t size, size_t nmemb, void* userp) {
+    size_t total = size * nmemb;
+    parse_response_header(std::string_view(data, total), *static_cast<HttpResponse*>(userp));
+    return total;
+}
+
+} // namespace detail
+
+// ---------------------------------------------------------
+// Pluggable transport
+// ---------------------------------------------------------
+
+/*!
+ * @struct TransportRequest
+ * @brief One GET request handed to a Transport
+ */
+struct TransportRequest {
+    std::string_view url;                  ///< Absolute URL of the release endpoint
+    std::span<const std::string> headers;  ///< Additional request headers ("Name: value"), e.g. If-None-Match
+    std::chrono::milliseconds connectTimeout{0};   ///< Limit for establishing a connection (0 = transport default)
+    std::chrono::milliseconds transferTimeout{0};  ///< Limit for the complete request (0 = none)
+    std::stop_token stopToken{};           ///< Requests cancellation of the running request
+};
+
+/*!
+ * @class Transport
+ * @brief HTTP GET implementation used by update checks
+ *
+ * Update checks use libcurl through Client by default. Setting
+ * CheckOptions::transport routes their release requests through another
+ * implementation instead, e.g. the HTTP client an application already
+ * runs, a pooled client, or an in-process fake for tests and benchmarks.
+ * Retries, rate limit pacing, conditional requests, metrics and tag
+ * extraction stay in the checker and work the same with every transport.
+ *
+ * Implementations must be thread-safe when one instance is shared by
+ * concurrent checks (check_github_updates(), Watcher).
+ *
+ * @example
+ * ```cpp
+ * class MyTransport : public ghupdate::Transport {
+ * public:
+ *     ghupdate::HttpResponse get(const ghupdate::TransportRequest& request,
+ *                                const BodySink& onBody) override {
+ *         auto reply = my_http.get(request.url, request.headers);  // application's own stack
+ *         ghupdate::HttpResponse response;
+ *         response.status = reply.status;
+ *         for (const auto& line : reply.header_lines)
+ *             ghupdate::parse_response_header(line, response);
+ *         onBody(reply.body);
+ *         return response;
+ *     }
+ * };
+ *
+ * MyTransport transport;
+ * auto info = ghupdate::check_github_update(url, "3.11.2", {.transport = &transport});
+ * ```
+ */
+class Transport {
+public:
+    /// Receives the response body in order; returning false ends the transfer early
+    using BodySink = std::function<bool(std::string_view)>;
+
+    virtual ~Transport() = default;
+
+    /*!
+     * @brief Performs a GET request
+     *
+     * Implementations should send kUserAgent (GitHub rejects requests
+     * without a User-Agent) and any authorization the application uses,
+     * pass every chunk of the body to @p onBody and stop reading once it
+     * returns false.
+     *
+     * @param request URL, headers, timeouts and stop token
+     * @param onBody Called with each chunk of the response body
+     * @return Status and the fields of parse_response_header(); the body
+     *         member is not used
+     * @throws std::runtime_error if no complete response was received
+     *         (connection failure, timeout, cancellation); the attempt is
+     *         then retried according to CheckOptions::retry
+     */
+    virtual HttpResponse get(const TransportRequest& request, const BodySink& onBody) = 0;
+};
+
 /*!
  * @brief Performs an HTTP GET request
  *
@@ -135,18 +787,16 @@ static size_t write_callback(void* contents, size_t size, size_t nmemb, void* us
  * @return Response body as std::string
  * @throws std::runtime_error on curl initialization failure or network error
  *
- * @note Sets User-Agent header to "C++23-gh-update-checker"
+ * @note Sets User-Agent header to "C++23-gh-update-checker" and the default
+ *       connect (10 s) and transfer (30 s) timeouts
  */
 inline std::string http_get(std::string_view url) {
+    detail::ensure_curl_initialized();
     CURL* curl = curl_easy_init();
     if (!curl) throw std::runtime_error("curl init failed");
 
     std::string buffer;
-
-    curl_easy_setopt(curl, CURLOPT_URL, url.data());
-    curl_easy_setopt(curl, CURLOPT_USERAGENT, "C++23-gh-update-checker");
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_callback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &buffer);
+    detail::configure_get(curl, url, &buffer);
 
     CURLcode res = curl_easy_perform(curl);
     curl_easy_cleanup(curl);
@@ -157,10 +807,221 @@ inline std::string http_get(std::string_view url) {
     return buffer;
 }
 
+namespace detail {
+
+/*!
+ * @brief Write target that streams the body into a ReleaseTagExtractor
+ *
+ * Once tag_name is known the rest of the body is either discarded unread
+ * (keeping a keep-alive connection reusable) or the transfer is aborted
+ * right away, depending on the abort policy.
+ */
+struct TagSink {
+    /*!
+     * @brief What to do with the rest of the body once tag_name is known
+     */
+    enum class Abort {
+        Never,   ///< Discard the remaining bytes so the connection stays reusable
+        Always,  ///< Abort the transfer (one-shot requests)
+        IfHttp2  ///< Abort only HTTP/2 transfers, where it merely resets the stream
+    };
+
+    ReleaseTagExtractor extractor;
+    Abort abort = Abort::Never;
+    CURL* easy = nullptr;  ///< Handle of the transfer, required for Abort::IfHttp2
+    std::chrono::steady_clock::duration* parseTime = nullptr;  ///< Accumulates time spent in the extractor
+
+    /*!
+     * @brief Consumes the next chunk of the body
+     * @return false if the transfer should be aborted
+     */
+    bool feed(std::string_view chunk) {
+        if (extractor.done())
+            return !should_abort();
+
+        const auto started = parseTime ? std::chrono::steady_clock::now()
+                                       : std::chrono::steady_clock::time_point{};
+        bool found = extractor.feed(chunk);
+        if (parseTime)
+            *parseTime += std::chrono::steady_clock::now() - started;
+        return !found || !should_abort();
+    }
+
+    static size_t write(char* data, size_t size, size_t nmemb, void* userp) {
+        size_t total = size * nmemb;
+        return static_cast<TagSink*>(userp)->feed({data, total}) ? total : 0;
+    }
+
+    bool should_abort() const {
+        if (abort != Abort::IfHttp2)
+            return abort == Abort::Always;
+        long version = 0;
+        curl_easy_getinfo(easy, CURLINFO_HTTP_VERSION, &version);
+        return version == CURL_HTTP_VERSION_2_0;
+    }
+
+    /*!
+     * @brief Whether a transfer result is acceptable for this sink
+     *
+     * A write error caused by the deliberate abort counts as success.
+     */
+    bool succeeded(CURLcode code) const {
+        return code == CURLE_OK || (code == CURLE_WRITE_ERROR && extractor.done());
+    }
+};
+
+} // namespace detail
+
 // ---------------------------------------------------------
 // Automatic GitHub URL to API URL conversion
 // ---------------------------------------------------------
 
+namespace detail {
+
+/*!
+ * @brief Case-insensitive search for an ASCII needle
+ */
+inline std::size_t find_icase(std::string_view haystack, std::string_view needle, std::size_t from) {
+    auto lower = [](char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c; };
+    for (std::size_t i = from; i + needle.size() <= haystack.size(); ++i) {
+        std::size_t j = 0;
+        while (j < needle.size() && lower(haystack[i + j]) == needle[j])
+            ++j;
+        if (j == needle.size())
+            return i;
+    }
+    return std::string_view::npos;
+}
+
+/*!
+ * @brief Single-pass conversion of a repository URL to its API URL
+ *
+ * Looks for a "github.com" host that is preceded by nothing, a scheme
+ * ("https://", "ssh://", ...), "www." or a "user@" part, and followed by
+ * "/owner/repo" or (scp-like syntax) ":owner/repo". Everything after the
+ * repository name (trailing slashes, "/tree/...", query, fragment) and a
+ * ".git" suffix are ignored.
+ *
+ * @return API URL, or std::nullopt if no repository could be found
+ */
+inline std::optional<std::string> parse_github_api_url(std::string_view url) {
+    if (url.find("api.github.com") != std::string_view::npos)
+        return std::string(url);
+
+    constexpr std::string_view host = "github.com";
+    for (std::size_t pos = find_icase(url, host, 0); pos != std::string_view::npos;
+         pos = find_icase(url, host, pos + 1)) {
+        std::string_view prefix = url.substr(0, pos);
+        if (prefix.size() >= 4 && find_icase(prefix, "www.", prefix.size() - 4) != std::string_view::npos)
+            prefix.remove_suffix(4);
+        bool hasScheme = prefix.find("://") != std::string_view::npos;
+        if (!(prefix.empty() || prefix.ends_with("://") || prefix.ends_with('@')))
+            continue;
+
+        std::size_t i = pos + host.size();
+        if (i >= url.size())
+            continue;
+        if (url[i] == ':') {
+            ++i;
+            // "ssh://git@github.com:22/owner/repo": skip the port
+            std::size_t digits = detail::digits_end(url, i);
+            if (hasScheme && digits > i && digits < url.size() && url[digits] == '/')
+                i = digits + 1;
+        } else if (url[i] == '/') {
+            ++i;
+        } else {
+            continue;
+        }
+
+        std::string_view rest = url.substr(i);
+        std::size_t ownerEnd = rest.find('/');
+        if (ownerEnd == 0 || ownerEnd == std::string_view::npos)
+            continue;
+        std::string_view owner = rest.substr(0, ownerEnd);
+        std::string_view repo = rest.substr(ownerEnd + 1);
+        repo = repo.substr(0, repo.find_first_of("/?#"));
+        if (repo.ends_with(".git"))
+            repo.remove_suffix(4);
+        if (repo.empty())
+            continue;
+
+        constexpr std::string_view apiPrefix = "https://api.github.com/repos/";
+        constexpr std::string_view apiSuffix = "/releases/latest";
+        std::string api;
+        api.reserve(apiPrefix.size() + owner.size() + 1 + repo.size() + apiSuffix.size());
+        api.append(apiPrefix).append(owner).append("/").append(repo).append(apiSuffix);
+        return api;
+    }
+    return std::nullopt;
+}
+
+/*!
+ * @brief Process-wide interning table of API URLs
+ *
+ * Maps raw input URLs to a single stored copy of their API URL. Entries are
+ * never removed, so returned views stay valid for the lifetime of the
+ * program. Distinct raw spellings beyond kMaxAliases are still resolved
+ * through the canonical set, only without a dedicated alias entry.
+ */
+class ApiUrlTable {
+public:
+    static ApiUrlTable& instance() {
+        static ApiUrlTable table;
+        return table;
+    }
+
+    std::string_view resolve(std::string_view url) {
+        {
+            std::shared_lock lock(mutex_);
+            if (auto it = aliases_.find(url); it != aliases_.end())
+                return it->second;
+        }
+
+        std::optional<std::string> api = parse_github_api_url(url);
+        if (!api)
+            throw std::runtime_error("Invalid GitHub URL: " + std::string(url));
+
+        std::unique_lock lock(mutex_);
+        std::string_view canonical = *canonical_.insert(std::move(*api)).first;
+        if (aliases_.size() < kMaxAliases)
+            aliases_.try_emplace(std::string(url), canonical);
+        return canonical;
+    }
+
+private:
+    static constexpr std::size_t kMaxAliases = 4096;
+
+    struct Hash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view s) const noexcept {
+            return std::hash<std::string_view>{}(s);
+        }
+    };
+
+    std::shared_mutex mutex_;
+    std::unordered_set<std::string, Hash, std::equal_to<>> canonical_;
+    std::unordered_map<std::string, std::string_view, Hash, std::equal_to<>> aliases_;
+};
+
+} // namespace detail
+
+/*!
+ * @brief Converts a GitHub repository URL to an interned GitHub API URL
+ *
+ * Same conversion as to_github_api_url(), but the result is stored in a
+ * process-wide interning table: repeated lookups of the same input return
+ * a view of the same string without allocating, and all spellings of one
+ * repository share a single copy. The view stays valid until the program
+ * exits.
+ *
+ * @param url GitHub repository URL or API URL
+ * @return View of the GitHub API URL for fetching releases
+ * @throws std::runtime_error if URL format is invalid
+ */
+inline std::string_view to_github_api_url_view(std::string_view url) {
+    return detail::ApiUrlTable::instance().resolve(url);
+}
+
 /*!
  * @brief Converts GitHub repository URLs to GitHub API URLs
  *
@@ -171,6 +1032,9 @@ inline std::string http_get(std::string_view url) {
  * Supported formats:
  *  - Standard URLs: https://github.com/owner/repo
  *  - Standard URLs with .git: https://github.com/owner/repo.git
+ *  - http:// and www.github.com hosts, trailing slashes and page suffixes
+ *    such as https://github.com/owner/repo/tree/main
+ *  - SSH URLs: git@github.com:owner/repo.git, ssh://git@github.com/owner/repo.git
  *  - API URLs: https://api.github.com/repos/owner/repo/releases/latest
  *
  * @param url GitHub repository URL or API URL
@@ -184,44 +1048,289 @@ inline std::string http_get(std::string_view url) {
  * ```
  */
 inline std::string to_github_api_url(std::string_view url) {
-    if (url.find("api.github.com") != std::string::npos)
-        return std::string(url);
+    return std::string(to_github_api_url_view(url));
+}
 
-    std::regex re(R"(https://github\.com/([^/]+)/([^/]+))");
-    std::cmatch m;
+/*!
+ * @brief Returns the canonical "owner/repo" slug of a GitHub URL
+ *
+ * Accepts every URL form supported by to_github_api_url(). The slug is
+ * lower-cased, because GitHub owner and repository names are
+ * case-insensitive, which makes it suitable as a cache key.
+ *
+ * @param url GitHub repository URL or API URL
+ * @return Slug such as "nlohmann/json"
+ * @throws std::runtime_error if URL format is invalid
+ */
+inline std::string github_repo_slug(std::string_view url) {
+    std::string_view rest = to_github_api_url_view(url);
 
-    if (!std::regex_search(url.begin(), url.end(), m, re))
+    auto pos = rest.find("/repos/");
+    if (pos == std::string_view::npos)
         throw std::runtime_error("Invalid GitHub URL: " + std::string(url));
+    rest.remove_prefix(pos + 7);
 
-    std::string owner = m[1];
-    std::string repo  = m[2];
-
-    if (repo.ends_with(".git"))
-        repo = repo.substr(0, repo.size() - 4);
+    auto owner_end = rest.find('/');
+    if (owner_end == 0 || owner_end == std::string_view::npos || owner_end + 1 >= rest.size())
+        throw std::runtime_error("Invalid GitHub URL: " + std::string(url));
+    auto repo_end = rest.find('/', owner_end + 1);
 
-    return "https://api.github.com/repos/" + owner + "/" + repo + "/releases/latest";
+    std::string slug(rest.substr(0, repo_end));
+    for (char& c : slug) {
+        if (c >= 'A' && c <= 'Z')
+            c = static_cast<char>(c - 'A' + 'a');
+    }
+    return slug;
 }
 
 // ---------------------------------------------------------
 // UpdateInfo
 // ---------------------------------------------------------
 
+/*!
+ * @struct CheckMetrics
+ * @brief Where the time of one update check went
+ *
+ * The network phases are consecutive slices of the last request attempt,
+ * derived from curl's CURLINFO_*_TIME_T values. Phases that did not happen
+ * (name resolution and connect on a reused connection, TLS over plain
+ * HTTP) are zero.
+ */
+struct CheckMetrics {
+    std::chrono::microseconds dns{0};          ///< Name resolution
+    std::chrono::microseconds connect{0};      ///< TCP connect
+    std::chrono::microseconds tls{0};          ///< TLS handshake
+    std::chrono::microseconds firstByte{0};    ///< Request sent until the first response byte (server time)
+    std::chrono::microseconds transfer{0};     ///< First until last response byte
+    std::chrono::microseconds tagParse{0};     ///< Streaming tag_name extraction, all attempts
+    std::chrono::microseconds semverParse{0};  ///< Parsing and comparing both versions
+    std::chrono::microseconds wait{0};         ///< Rate limit and retry backoff waits
+    std::chrono::microseconds total{0};        ///< Whole check, wall clock
+    int attempts = 0;                          ///< Request attempts made
+    bool connectionReused = false;             ///< Last attempt ran on an already open connection
+};
+
 /*!
  * @struct UpdateInfo
  * @brief Result of a GitHub update check
  *
- * Contains the outcome of comparing a local version with the latest
- * remote release on GitHub.
+ * Contains the outcome of comparing a local version with the latest
+ * remote release on GitHub.
+ */
+struct UpdateInfo {
+    bool hasUpdate = false;      ///< true if remote version > local version
+    std::string latestVersion;   ///< Latest release tag/version from GitHub
+    bool notModified = false;    ///< true if GitHub answered 304 and the stored release was reused
+    std::optional<CheckMetrics> metrics{};  ///< Timings, if CheckOptions::collectMetrics was set
+};
+
+namespace detail {
+
+/*!
+ * @brief Splits curl's cumulative timings of the last transfer into phases
+ */
+inline void read_phase_times(CURL* curl, CheckMetrics& metrics) {
+    curl_off_t lookup = 0, connect = 0, appConnect = 0, preTransfer = 0, startTransfer = 0, total = 0;
+    long connects = 0;
+    curl_easy_getinfo(curl, CURLINFO_NAMELOOKUP_TIME_T, &lookup);
+    curl_easy_getinfo(curl, CURLINFO_CONNECT_TIME_T, &connect);
+    curl_easy_getinfo(curl, CURLINFO_APPCONNECT_TIME_T, &appConnect);
+    curl_easy_getinfo(curl, CURLINFO_PRETRANSFER_TIME_T, &preTransfer);
+    curl_easy_getinfo(curl, CURLINFO_STARTTRANSFER_TIME_T, &startTransfer);
+    curl_easy_getinfo(curl, CURLINFO_TOTAL_TIME_T, &total);
+    curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &connects);
+
+    // Phases that did not happen report 0 instead of a cumulative time
+    auto span = [](curl_off_t from, curl_off_t to) {
+        return std::chrono::microseconds(to > from ? to - from : 0);
+    };
+    metrics.dns = span(0, lookup);
+    metrics.connect = span(lookup, connect);
+    metrics.tls = appConnect > 0 ? span(connect, appConnect) : std::chrono::microseconds(0);
+    metrics.firstByte = span(preTransfer, startTransfer);
+    metrics.transfer = span(startTransfer, total);
+    metrics.connectionReused = connects == 0;
+}
+
+} // namespace detail
+
+// ---------------------------------------------------------
+// Check options
+// ---------------------------------------------------------
+
+/*!
+ * @struct RetryPolicy
+ * @brief Exponential backoff with full jitter for transient failures
+ *
+ * Attempt n (n >= 1) that failed transiently is retried after a random
+ * delay in [0, min(maxBackoff, initialBackoff * multiplier^(n-1))]. A
+ * Retry-After header of the response raises the delay to at least its
+ * value.
+ */
+struct RetryPolicy {
+    int maxAttempts = 3;                            ///< Total attempts per check (1 disables retries)
+    std::chrono::milliseconds initialBackoff{200};  ///< Backoff cap after the first failure
+    std::chrono::milliseconds maxBackoff{5'000};    ///< Upper bound of the backoff cap
+    double multiplier = 2.0;                        ///< Growth of the cap per attempt
+};
+
+/*!
+ * @struct CheckOptions
+ * @brief Optional behaviour of a single update check
+ */
+struct CheckOptions {
+    /*!
+     * Store of ETag / Last-Modified validators. If set, known validators
+     * are sent as If-None-Match / If-Modified-Since and a 304 response is
+     * answered from the store without a body or JSON parsing. Fresh
+     * validators of 200 responses are recorded.
+     */
+    ValidatorStore* validators = nullptr;
+
+    /*!
+     * Rate limit scheduler shared by all checks using the same token. If
+     * set, each request waits for a send slot and feeds the X-RateLimit-*
+     * and Retry-After headers of its response back to the scheduler.
+     */
+    RateLimitScheduler* scheduler = nullptr;
+
+    /// Limit for establishing a connection per attempt (0 = curl's default of 300 s)
+    std::chrono::milliseconds connectTimeout = detail::kDefaultConnectTimeout;
+
+    /// Limit for one complete request attempt (0 = no limit)
+    std::chrono::milliseconds transferTimeout = detail::kDefaultTransferTimeout;
+
+    /// Overall time budget of the check including retries and backoff (0 = none)
+    std::chrono::milliseconds deadline{0};
+
+    /// Retries of transient failures (connection errors, timeouts, 5xx, 429)
+    RetryPolicy retry{};
+
+    /*!
+     * Cancels the check when stop is requested: a running transfer is
+     * aborted within milliseconds, and backoff and rate limit waits are
+     * interrupted. A cancelled check throws "Check cancelled".
+     */
+    std::stop_token stopToken{};
+
+    /// Fill UpdateInfo::metrics with per-phase timings of the check
+    bool collectMetrics = false;
+
+    /*!
+     * Registry counting requests, 304 answers, retries, outcomes and the
+     * rate limit budget and recording per-phase latencies. Updates are
+     * lock-free; share one registry between all checks.
+     */
+    MetricsRegistry* metrics = nullptr;
+
+    /*!
+     * Performs the release requests instead of libcurl. The DNS, connect,
+     * TLS, first byte and transfer phases of CheckMetrics are then not
+     * measured. MultiEngine always uses curl_multi and ignores it.
+     */
+    Transport* transport = nullptr;
+};
+
+// ---------------------------------------------------------
+// Release response evaluation
+// ---------------------------------------------------------
+
+/*!
+ * @class ApiError
+ * @brief GitHub answered a release request, but not with a usable release
+ *
+ * Carries the HTTP status of the answer. Transport failures, cancellation
+ * and deadlines are reported as plain std::runtime_error instead.
+ */
+class ApiError : public std::runtime_error {
+public:
+    ApiError(const std::string& message, long status)
+        : std::runtime_error(message), status_(status) {}
+
+    /*!
+     * @brief HTTP status of the response (0 if unknown)
+     */
+    long status() const noexcept { return status_; }
+
+    /*!
+     * @brief true if asking again cannot give a different answer soon
+     *
+     * A release document without a valid tag_name and a missing repository
+     * or release (404, 410, 451) are definitive; rate limits (403, 429),
+     * server errors and anything else may succeed on the next request.
+     */
+    bool definitive() const noexcept {
+        return status_ == 200 || status_ == 404 || status_ == 410 || status_ == 451;
+    }
+
+private:
+    long status_;
+};
+
+/*!
+ * @brief Release tag of a /releases/latest response, or the error it describes
+ *
+ * @param status HTTP status of the response
+ * @param extractor Extractor that was fed the response body
+ * @return Value of tag_name
+ * @throws ApiError "GitHub API error: <message>" for error responses
+ *         ("GitHub API error: HTTP <status>" if the body has no message), or
+ *         "GitHub API returned no valid tag_name" for a 200 without one
+ */
+inline std::string release_tag(long status, const ReleaseTagExtractor& extractor) {
+    if (status == 200 && extractor.tag())
+        return *extractor.tag();
+    if (extractor.message())
+        throw ApiError("GitHub API error: " + *extractor.message(), status);
+    if (status != 200)
+        throw ApiError("GitHub API error: HTTP " + std::to_string(status), status);
+    throw ApiError("GitHub API returned no valid tag_name", status);
+}
+
+/*!
+ * @brief Extracts the release tag from a /releases/latest response body
+ *
+ * @param jsonText Response body of the /releases/latest endpoint
+ * @return Value of the tag_name field
+ * @throws std::runtime_error if the response carries a GitHub API error
+ *         message or no valid tag_name
+ */
+inline std::string parse_latest_tag(std::string_view jsonText) {
+    ReleaseTagExtractor extractor;
+    extractor.feed(jsonText);
+    return extractor.tag_or_throw();
+}
+
+/*!
+ * @brief Evaluates a /releases/latest response body against a local version
+ *
+ * Extracts the tag_name field from the GitHub API response and compares it
+ * with the local version. Used by every transport after the body has been
+ * received.
+ *
+ * @param jsonText Response body of the /releases/latest endpoint
+ * @param localVersion Local version string (will be parsed as SemVer)
+ * @return UpdateInfo for the given response
+ * @throws std::runtime_error on GitHub API errors or invalid version strings
  */
-struct UpdateInfo {
-    bool hasUpdate;              ///< true if remote version > local version
-    std::string latestVersion;   ///< Latest release tag/version from GitHub
-};
+inline UpdateInfo parse_update_info(std::string_view jsonText, std::string_view localVersion) {
+    std::string latest = parse_latest_tag(jsonText);
+
+    SemVer local = SemVer::parse(localVersion);
+    SemVer remote = SemVer::parse(latest);
+
+    return { remote > local, latest };
+}
 
 // ---------------------------------------------------------
 // Synchronous version checking function
 // ---------------------------------------------------------
 
+inline UpdateInfo check_github_update(
+    std::string_view repoUrl,
+    std::string_view localVersion,
+    const CheckOptions& options);
+
 /*!
  * @brief Checks for updates on a GitHub repository (synchronous)
  *
@@ -231,7 +1340,8 @@ struct UpdateInfo {
  * Workflow:
  *  1. Converts the input URL to a GitHub API endpoint if needed
  *  2. Performs HTTP GET request to retrieve release information
- *  3. Parses JSON response to extract the tag_name field
+ *  3. Streams the response to extract the tag_name field, stopping the
+ *     transfer as soon as it is known
  *  4. Compares versions using SemVer comparison
  *
  * @param repoUrl GitHub repository URL or API URL
@@ -269,24 +1379,681 @@ inline UpdateInfo check_github_update(
     std::string_view repoUrl,
     std::string_view localVersion
 ) {
-    std::string apiUrl = to_github_api_url(repoUrl);
+    return check_github_update(repoUrl, localVersion, CheckOptions{});
+}
+
+namespace detail {
+
+/*!
+ * @brief Sleeps for @p duration unless stop is requested earlier
+ * @return false if the sleep was interrupted by @p stop
+ */
+inline bool sleep_for(std::chrono::milliseconds duration, const std::stop_token& stop) {
+    if (!stop.stop_possible()) {
+        std::this_thread::sleep_for(duration);
+        return true;
+    }
+    std::mutex mutex;
+    std::condition_variable_any cv;
+    std::unique_lock lock(mutex);
+    cv.wait_for(lock, stop, duration, [] { return false; });
+    return !stop.stop_requested();
+}
+
+/*!
+ * @brief CURL xferinfo callback aborting the transfer once stop is requested
+ */
+inline int stop_xferinfo(void* userp, curl_off_t, curl_off_t, curl_off_t, curl_off_t) {
+    return static_cast<const std::stop_token*>(userp)->stop_requested() ? 1 : 0;
+}
+
+/*!
+ * @brief Backoff before the next attempt, or std::nullopt to give up
+ *
+ * Connection failures, timeouts, resets, HTTP/2 stream errors, 5xx
+ * responses, 429 and 403 with Retry-After (secondary rate limit) are
+ * transient. A Retry-After longer than the policy's maxBackoff is not
+ * waited for; RateLimitScheduler handles such pauses.
+ *
+ * @param policy Retry policy of the check
+ * @param attempt Number of the attempt that just finished (1-based)
+ * @param code Transfer result (CURLE_OK if the response was received)
+ * @param response Status and headers of the response
+ */
+inline std::optional<std::chrono::milliseconds> retry_delay(const RetryPolicy& policy, int attempt,
+                                                            CURLcode code, const HttpResponse& response) {
+    if (attempt >= policy.maxAttempts)
+        return std::nullopt;
+
+    bool transient = false;
+    switch (code) {
+    case CURLE_OK:
+        transient = response.status == 429 || (response.status >= 500 && response.status <= 599) ||
+                    (response.status == 403 && response.rateLimit.retryAfter);
+        break;
+    case CURLE_COULDNT_CONNECT:
+    case CURLE_OPERATION_TIMEDOUT:
+    case CURLE_SEND_ERROR:
+    case CURLE_RECV_ERROR:
+    case CURLE_GOT_NOTHING:
+    case CURLE_PARTIAL_FILE:
+    case CURLE_SSL_CONNECT_ERROR:
+    case CURLE_HTTP2:
+    case CURLE_HTTP2_STREAM:
+        transient = true;
+        break;
+    default:
+        break;
+    }
+    if (!transient)
+        return std::nullopt;
+
+    auto cap = policy.initialBackoff;
+    for (int i = 1; i < attempt && cap < policy.maxBackoff; ++i)
+        cap = std::chrono::milliseconds(static_cast<long long>(static_cast<double>(cap.count()) * policy.multiplier));
+    cap = std::min(cap, policy.maxBackoff);
+
+    thread_local std::mt19937_64 rng{std::random_device{}()};
+    std::chrono::milliseconds delay(std::uniform_int_distribution<long long>(0, std::max<long long>(cap.count(), 0))(rng));
+
+    if (auto retryAfter = response.rateLimit.retryAfter) {
+        if (*retryAfter > policy.maxBackoff)
+            return std::nullopt;
+        delay = std::max<std::chrono::milliseconds>(delay, *retryAfter);
+    }
+    return delay;
+}
+
+} // namespace detail
+
+// ---------------------------------------------------------
+// Reusable client with persistent connections
+// ---------------------------------------------------------
+
+/*!
+ * @class SharedCache
+ * @brief Thread-safe curl share handle for DNS, TLS sessions and connections
+ *
+ * Several Client instances (e.g. one per worker thread) can share a single
+ * SharedCache, so that name resolution results, TLS sessions and open
+ * connections to api.github.com are reused across all of them.
+ */
+class SharedCache {
+public:
+    SharedCache() {
+        detail::ensure_curl_initialized();
+        share_ = curl_share_init();
+        if (!share_) throw std::runtime_error("curl share init failed");
+
+        curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, &SharedCache::lock);
+        curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, &SharedCache::unlock);
+        curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+    }
+
+    ~SharedCache() {
+        curl_share_cleanup(share_);
+    }
+
+    SharedCache(const SharedCache&) = delete;
+    SharedCache& operator=(const SharedCache&) = delete;
+
+    /*!
+     * @brief Returns the underlying curl share handle
+     */
+    CURLSH* handle() const { return share_; }
+
+private:
+    static void lock(CURL*, curl_lock_data data, curl_lock_access, void* userptr) {
+        static_cast<SharedCache*>(userptr)->mutexes_[static_cast<std::size_t>(data)].lock();
+    }
+
+    static void unlock(CURL*, curl_lock_data data, void* userptr) {
+        static_cast<SharedCache*>(userptr)->mutexes_[static_cast<std::size_t>(data)].unlock();
+    }
+
+    CURLSH* share_ = nullptr;
+    std::array<std::mutex, CURL_LOCK_DATA_LAST> mutexes_;
+};
+
+/*!
+ * @class Client
+ * @brief Reusable HTTP client for sequences of update checks
+ *
+ * Unlike http_get(), which creates and destroys a curl handle per call, a
+ * Client keeps its easy handle alive between requests. Consecutive checks
+ * therefore reuse the open keep-alive connection, and the SharedCache adds
+ * DNS caching and TLS session resumption on top.
+ *
+ * A Client is not thread-safe; use one Client per thread and pass the same
+ * SharedCache to all of them.
+ *
+ * @example
+ * ```cpp
+ * ghupdate::Client client;
+ * for (const auto& [url, version] : repos) {
+ *     auto result = client.check(url, version);
+ *     // ...
+ * }
+ * ```
+ */
+class Client {
+public:
+    /*!
+     * @brief Creates a client with its own SharedCache
+     */
+    Client() : Client(std::make_shared<SharedCache>()) {}
+
+    /*!
+     * @brief Creates a client that uses an existing SharedCache
+     * @param cache Cache shared with other clients, or nullptr for a
+     *        stand-alone handle that only keeps its own connection
+     * @param abortAfterTag Abort release transfers as soon as tag_name is
+     *        known instead of draining the rest of the body; saves
+     *        bandwidth for one-shot checks but closes HTTP/1.1 connections
+     */
+    explicit Client(std::shared_ptr<SharedCache> cache, bool abortAfterTag = false)
+        : cache_(std::move(cache)),
+          easy_((detail::ensure_curl_initialized(), curl_easy_init()), &curl_easy_cleanup),
+          abortAfterTag_(abortAfterTag) {
+        if (!easy_) throw std::runtime_error("curl init failed");
+        if (cache_)
+            curl_easy_setopt(easy_.get(), CURLOPT_SHARE, cache_->handle());
+        curl_easy_setopt(easy_.get(), CURLOPT_TCP_KEEPALIVE, 1L);
+    }
+
+    /*!
+     * @brief Performs an HTTP GET request on the persistent handle
+     *
+     * @param url The URL to request
+     * @return Response body as std::string
+     * @throws std::runtime_error on network error
+     */
+    std::string get(std::string_view url) {
+        return fetch(url).body;
+    }
+
+    /*!
+     * @brief Performs an HTTP GET request and returns status and headers too
+     *
+     * @param url The URL to request
+     * @param headers Additional request headers ("Name: value")
+     * @return HttpResponse with status, body, ETag and Last-Modified
+     * @throws std::runtime_error on network error
+     */
+    HttpResponse fetch(std::string_view url, std::span<const std::string> headers = {}) {
+        HttpResponse response;
+        CURLcode res = perform(url, headers, write_callback, &response.body, response);
+        if (res != CURLE_OK)
+            throw std::runtime_error("HTTP request failed");
+        return response;
+    }
+
+    /*!
+     * @brief Performs an HTTP POST request on the persistent handle
+     *
+     * @param url The URL to request
+     * @param body Request body, sent as is
+     * @param headers Additional request headers ("Name: value"), e.g. Content-Type
+     * @return HttpResponse with status and body
+     * @throws std::runtime_error on network error
+     */
+    HttpResponse post(std::string_view url, const std::string& body,
+                      std::span<const std::string> headers = {}) {
+        HttpResponse response;
+        CURLcode res = perform(url, headers, write_callback, &response.body, response, &body);
+        if (res != CURLE_OK)
+            throw std::runtime_error("HTTP request failed");
+        return response;
+    }
+
+    /*!
+     * @brief Performs an HTTP POST request and streams the response body
+     *
+     * @param url The URL to request
+     * @param body Request body, sent as is
+     * @param headers Additional request headers ("Name: value")
+     * @param onData Called with each chunk of the response body as it
+     *        arrives; returning false stops the transfer early
+     * @return HttpResponse with status and headers (body left empty)
+     * @throws std::runtime_error on network error
+     */
+    HttpResponse post(std::string_view url, const std::string& body,
+                      std::span<const std::string> headers,
+                      const std::function<bool(std::string_view)>& onData) {
+        BodyStream stream{&onData};
+        HttpResponse response;
+        CURLcode res = perform(url, headers, &BodyStream::write, &stream, response, &body);
+        if (res != CURLE_OK && !(res == CURLE_WRITE_ERROR && stream.stopped))
+            throw std::runtime_error("HTTP request failed");
+        return response;
+    }
+
+    /*!
+     * @brief Performs a Transport request on the persistent handle
+     *
+     * The libcurl implementation of Transport::get(), used by CurlTransport.
+     *
+     * @param request URL, headers, timeouts and stop token
+     * @param onBody Called with each chunk of the response body; returning
+     *        false stops the transfer early
+     * @return HttpResponse with status and headers (body left empty)
+     * @throws std::runtime_error on network error or cancellation
+     */
+    HttpResponse get(const TransportRequest& request, const Transport::BodySink& onBody) {
+        BodyStream stream{&onBody};
+        HttpResponse response;
+        CURLcode res = perform(request.url, request.headers, &BodyStream::write, &stream, response, nullptr,
+                               {request.connectTimeout, request.transferTimeout}, request.stopToken);
+        if (res != CURLE_OK && !(res == CURLE_WRITE_ERROR && stream.stopped))
+            throw std::runtime_error("HTTP request failed");
+        return response;
+    }
+
+    /*!
+     * @brief Fetches the latest release tag of a GitHub repository
+     *
+     * Performs the request part of check() without comparing versions; the
+     * returned UpdateInfo has hasUpdate == false. The body is streamed
+     * through a ReleaseTagExtractor, so it is never buffered or parsed
+     * into a DOM.
+     *
+     * @param repoUrl GitHub repository URL or API URL
+     * @param options Optional behaviour such as conditional requests
+     * @return UpdateInfo with latestVersion (and notModified) filled in
+     * @throws ApiError if GitHub answered with an error or without a release
+     * @throws std::runtime_error on invalid URLs, network errors, cancellation
+     *         or an expired deadline
+     */
+    UpdateInfo latest_release(std::string_view repoUrl, const CheckOptions& options = {}) {
+        std::string_view apiUrl = to_github_api_url_view(repoUrl);
+
+        std::optional<ValidatorStore::Entry> known;
+        std::vector<std::string> headers;
+        if (options.validators) {
+            known = options.validators->find(apiUrl);
+            if (known && !known->etag.empty())
+                headers.push_back("If-None-Match: " + known->etag);
+            if (known && !known->lastModified.empty())
+                headers.push_back("If-Modified-Since: " + known->lastModified);
+        }
+
+        using std::chrono::steady_clock;
+        const auto started = steady_clock::now();
+        const auto deadline = options.deadline.count() > 0 ? started + options.deadline
+                                                            : steady_clock::time_point::max();
 
-    std::string jsonText = http_get(apiUrl);
-    auto json = nlohmann::json::parse(jsonText);
+        std::optional<CheckMetrics> metrics;
+        steady_clock::duration parseTime{0};
+        steady_clock::duration waitTime{0};
+        if (options.collectMetrics || options.metrics)
+            metrics.emplace();
 
-    if (!json.contains("tag_name") || !json["tag_name"].is_string()) {
-        if (json.contains("message") && json["message"].is_string()) {
-            throw std::runtime_error("GitHub API error: " + json["message"].get<std::string>());
+        HttpResponse response;
+        detail::TagSink sink;
+        CURLcode res = CURLE_OK;
+        std::string transportError;
+        for (int attempt = 1;; ++attempt) {
+            detail::Timeouts timeouts{options.connectTimeout, options.transferTimeout};
+            if (deadline != steady_clock::time_point::max()) {
+                auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - steady_clock::now());
+                if (left.count() <= 0)
+                    throw std::runtime_error("Deadline exceeded");
+                if (timeouts.transfer.count() == 0 || left < timeouts.transfer)
+                    timeouts.transfer = left;
+            }
+
+            if (options.scheduler) {
+                const auto waitStart = steady_clock::now();
+                options.scheduler->acquire(options.stopToken);
+                waitTime += steady_clock::now() - waitStart;
+            }
+            if (options.stopToken.stop_requested())
+                throw std::runtime_error("Check cancelled");
+
+            response = {};
+            sink = {};
+            sink.abort = abortAfterTag_ ? detail::TagSink::Abort::Always : detail::TagSink::Abort::Never;
+            sink.parseTime = metrics ? &parseTime : nullptr;
+            if (options.transport)
+                res = transport_get(*options.transport, apiUrl, headers, sink, response, timeouts,
+                                    options.stopToken, transportError);
+            else
+                res = perform(apiUrl, headers, &detail::TagSink::write, &sink, response, nullptr, timeouts,
+                              options.stopToken);
+            if (metrics)
+                metrics->attempts = attempt;
+            if (options.metrics) {
+                options.metrics->requests.inc();
+                if (response.rateLimit.remaining)
+                    options.metrics->rateLimitRemaining.set(*response.rateLimit.remaining);
+            }
+            if (options.scheduler)
+                options.scheduler->update(response.rateLimit, response.status);
+            if (res == CURLE_ABORTED_BY_CALLBACK && options.stopToken.stop_requested())
+                throw std::runtime_error("Check cancelled");
+
+            auto delay = detail::retry_delay(options.retry, attempt,
+                                             sink.succeeded(res) ? CURLE_OK : res, response);
+            if (!delay || steady_clock::now() + *delay >= deadline)
+                break;
+            if (!detail::sleep_for(*delay, options.stopToken))
+                throw std::runtime_error("Check cancelled");
+            waitTime += *delay;
+            if (options.metrics)
+                options.metrics->retries.inc();
+        }
+        if (!sink.succeeded(res)) {
+            if (steady_clock::now() >= deadline)
+                throw std::runtime_error("Deadline exceeded");
+            throw std::runtime_error(transportError.empty() ? "HTTP request failed"
+                                                            : "HTTP request failed: " + transportError);
+        }
+
+        UpdateInfo info;
+        if (metrics) {
+            if (!options.transport)
+                detail::read_phase_times(easy_.get(), *metrics);
+            metrics->tagParse = std::chrono::duration_cast<std::chrono::microseconds>(parseTime);
+            metrics->wait = std::chrono::duration_cast<std::chrono::microseconds>(waitTime);
+            metrics->total = std::chrono::duration_cast<std::chrono::microseconds>(steady_clock::now() - started);
+            if (options.metrics)
+                record_phases(*options.metrics, *metrics, !options.transport);
+            if (options.collectMetrics)
+                info.metrics = metrics;
+        }
+        if (response.status == 304 && known) {
+            if (options.metrics)
+                options.metrics->notModified.inc();
+            info.latestVersion = known->latestVersion;
+            info.notModified = true;
+            return info;
+        }
+
+        info.latestVersion = release_tag(response.status, sink.extractor);
+
+        if (options.validators && response.status == 200 &&
+            (!response.etag.empty() || !response.lastModified.empty())) {
+            options.validators->store(std::string(apiUrl), {std::move(response.etag),
+                                                          std::move(response.lastModified),
+                                                          info.latestVersion});
         }
-        throw std::runtime_error("GitHub API returned no valid tag_name");
+        return info;
     }
 
-    std::string latest = json["tag_name"].get<std::string>();
+    /*!
+     * @brief Checks for updates on a GitHub repository using this client
+     *
+     * Same semantics as the free check_github_update(), but the request runs
+     * over this client's persistent connection.
+     *
+     * @param repoUrl GitHub repository URL or API URL
+     * @param localVersion Local version string (will be parsed as SemVer)
+     * @param options Optional behaviour such as conditional requests
+     * @return UpdateInfo with the comparison result
+     * @throws std::runtime_error on the same conditions as check_github_update()
+     */
+    UpdateInfo check(std::string_view repoUrl, std::string_view localVersion,
+                     const CheckOptions& options = {}) {
+        try {
+            const auto started = std::chrono::steady_clock::now();
+            UpdateInfo info = latest_release(repoUrl, options);
 
-    SemVer local = SemVer::parse(localVersion);
-    SemVer remote = SemVer::parse(latest);
+            const auto parseStart = std::chrono::steady_clock::now();
+            SemVer local = SemVer::parse(localVersion);
+            SemVer remote = SemVer::parse(info.latestVersion);
+            info.hasUpdate = remote > local;
 
-    return { remote > local, latest };
+            if (info.metrics || options.metrics) {
+                const auto now = std::chrono::steady_clock::now();
+                const auto parse = std::chrono::duration_cast<std::chrono::microseconds>(now - parseStart);
+                if (info.metrics) {
+                    info.metrics->semverParse = parse;
+                    info.metrics->total = std::chrono::duration_cast<std::chrono::microseconds>(now - started);
+                }
+                if (options.metrics) {
+                    options.metrics->observe(Phase::SemverParse, parse);
+                    (info.hasUpdate ? options.metrics->checksUpdate : options.metrics->checksCurrent).inc();
+                }
+            }
+            return info;
+        } catch (...) {
+            if (options.metrics)
+                options.metrics->checkErrors.inc();
+            throw;
+        }
+    }
+
+    /*!
+     * @brief Returns the cache shared by this client
+     */
+    const std::shared_ptr<SharedCache>& shared_cache() const { return cache_; }
+
+private:
+    /*!
+     * @brief curl write target forwarding the body to a callback
+     */
+    struct BodyStream {
+        const std::function<bool(std::string_view)>* onData;
+        bool stopped = false;
+
+        static size_t write(char* data, size_t size, size_t nmemb, void* userp) {
+            auto* self = static_cast<BodyStream*>(userp);
+            if (!(*self->onData)(std::string_view(data, size * nmemb))) {
+                self->stopped = true;
+                return 0;
+            }
+            return size * nmemb;
+        }
+    };
+
+    /*!
+     * @brief Runs one release request through a custom Transport
+     *
+     * Maps the outcome onto the CURLcode values the retry logic expects: a
+     * thrown exception counts as a transient receive error (its message is
+     * kept in @p error), a cancelled request as an aborted transfer.
+     */
+    static CURLcode transport_get(Transport& transport, std::string_view url, std::span<const std::string> headers,
+                                  detail::TagSink& sink, HttpResponse& response, const detail::Timeouts& timeouts,
+                                  const std::stop_token& stop, std::string& error) {
+        try {
+            response = transport.get({url, headers, timeouts.connect, timeouts.transfer, stop},
+                                     [&sink](std::string_view chunk) { return sink.feed(chunk); });
+        } catch (const std::exception& e) {
+            error = e.what();
+            return stop.stop_requested() ? CURLE_ABORTED_BY_CALLBACK : CURLE_RECV_ERROR;
+        }
+        error.clear();
+        return CURLE_OK;
+    }
+
+    /*!
+     * @brief Records the phases of one request in a registry
+     *
+     * SemVer parsing is recorded by check(), which performs it. Without
+     * @p network (custom Transport) the curl phases are unknown and skipped.
+     */
+    static void record_phases(MetricsRegistry& registry, const CheckMetrics& m, bool network) noexcept {
+        if (network) {
+            registry.observe(Phase::Dns, m.dns);
+            registry.observe(Phase::Connect, m.connect);
+            registry.observe(Phase::Tls, m.tls);
+            registry.observe(Phase::FirstByte, m.firstByte);
+            registry.observe(Phase::Transfer, m.transfer);
+        }
+        registry.observe(Phase::TagParse, m.tagParse);
+        registry.observe(Phase::Wait, m.wait);
+        registry.observe(Phase::Total, m.total);
+    }
+
+    /*!
+     * @brief Runs one request with a caller-supplied body consumer
+     *
+     * Sends a GET, or a POST of @p postBody if given, within @p timeouts.
+     * Fills status and headers of @p response; the response body goes to
+     * @p write.
+     */
+    CURLcode perform(std::string_view url, std::span<const std::string> headers,
+                     curl_write_callback write, void* userdata, HttpResponse& response,
+                     const std::string* postBody = nullptr, const detail::Timeouts& timeouts = {},
+                     std::stop_token stop = {}) {
+        CURL* curl = easy_.get();
+        detail::configure_get(curl, url, nullptr, timeouts);
+        if (postBody) {
+            curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(postBody->size()));
+            curl_easy_setopt(curl, CURLOPT_POSTFIELDS, postBody->data());
+        }
+        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write);
+        curl_easy_setopt(curl, CURLOPT_WRITEDATA, userdata);
+        curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, detail::header_callback);
+        curl_easy_setopt(curl, CURLOPT_HEADERDATA, &response);
+
+        std::unique_ptr<curl_slist, decltype(&curl_slist_free_all)> list(nullptr, &curl_slist_free_all);
+        for (const auto& header : headers) {
+            curl_slist* appended = curl_slist_append(list.get(), header.c_str());
+            if (!appended) throw std::runtime_error("curl header allocation failed");
+            list.release();
+            list.reset(appended);
+        }
+        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, list.get());
+
+        CURLcode res = stop.stop_possible() ? perform_cancellable(curl, stop) : curl_easy_perform(curl);
+        curl_easy_setopt(curl, CURLOPT_HTTPHEADER, nullptr);
+        if (postBody)
+            curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response.status);
+        return res;
+    }
+
+    /*!
+     * @brief Runs the transfer on a private multi handle so it can be stopped
+     *
+     * curl_easy_perform() may sit in poll() for up to a second without
+     * calling back. Driving the handle through curl_multi_poll() instead
+     * lets a stop request wake the loop immediately via curl_multi_wakeup();
+     * the xferinfo callback additionally aborts in the middle of a transfer.
+     */
+    CURLcode perform_cancellable(CURL* curl, const std::stop_token& stop) {
+        if (stop.stop_requested())
+            return CURLE_ABORTED_BY_CALLBACK;
+        if (!multi_) {
+            multi_.reset(curl_multi_init());
+            if (!multi_) throw std::runtime_error("curl init failed");
+        }
+        CURLM* multi = multi_.get();
+
+        curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+        curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, &detail::stop_xferinfo);
+        curl_easy_setopt(curl, CURLOPT_XFERINFODATA, &stop);
+        curl_multi_add_handle(multi, curl);
+
+        CURLcode res = CURLE_OK;
+        {
+            std::stop_callback wake(stop, [multi] { curl_multi_wakeup(multi); });
+            for (;;) {
+                int running = 0;
+                if (curl_multi_perform(multi, &running) != CURLM_OK) {
+                    res = CURLE_RECV_ERROR;
+                    break;
+                }
+                if (running == 0) {
+                    int queued = 0;
+                    while (CURLMsg* msg = curl_multi_info_read(multi, &queued)) {
+                        if (msg->msg == CURLMSG_DONE)
+                            res = msg->data.result;
+                    }
+                    break;
+                }
+                if (stop.stop_requested()) {
+                    res = CURLE_ABORTED_BY_CALLBACK;
+                    break;
+                }
+                curl_multi_poll(multi, nullptr, 0, 1000, nullptr);
+            }
+        }
+
+        curl_multi_remove_handle(multi, curl);
+        curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 1L);
+        curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, nullptr);
+        return res;
+    }
+
+    std::shared_ptr<SharedCache> cache_;
+    std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> easy_;
+    std::unique_ptr<CURLM, decltype(&curl_multi_cleanup)> multi_{nullptr, &curl_multi_cleanup};
+    bool abortAfterTag_ = false;
+};
+
+/*!
+ * @class CurlTransport
+ * @brief Transport over libcurl, the implementation checks use by default
+ *
+ * Keeps a pool of Clients sharing one SharedCache, so concurrent requests
+ * each get their own handle while connections, DNS results and TLS
+ * sessions are reused. Useful as the inner transport of a decorator, e.g.
+ * one that logs or signs requests.
+ */
+class CurlTransport : public Transport {
+public:
+    explicit CurlTransport(std::shared_ptr<SharedCache> cache = std::make_shared<SharedCache>())
+        : cache_(std::move(cache)) {}
+
+    HttpResponse get(const TransportRequest& request, const BodySink& onBody) override {
+        std::unique_ptr<Client> client;
+        {
+            std::lock_guard lock(mutex_);
+            if (!idle_.empty()) {
+                client = std::move(idle_.back());
+                idle_.pop_back();
+            }
+        }
+        if (!client)
+            client = std::make_unique<Client>(cache_);
+
+        HttpResponse response = client->get(request, onBody);  // a failed handle is dropped
+
+        std::lock_guard lock(mutex_);
+        idle_.push_back(std::move(client));
+        return response;
+    }
+
+private:
+    std::shared_ptr<SharedCache> cache_;
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<Client>> idle_;
+};
+
+/*!
+ * @brief Checks for updates on a GitHub repository with options (synchronous)
+ *
+ * Same as check_github_update(repoUrl, localVersion), plus the behaviour
+ * selected in @p options (e.g. conditional requests through a
+ * ValidatorStore).
+ *
+ * @param repoUrl GitHub repository URL or API URL
+ * @param localVersion Local version string (will be parsed as SemVer)
+ * @param options Optional behaviour of this check
+ * @return UpdateInfo with the comparison result
+ * @throws std::runtime_error on the same conditions as check_github_update()
+ *
+ * @example
+ * ```cpp
+ * ghupdate::ValidatorStore store("etags.json");
+ * auto result = ghupdate::check_github_update(
+ *     "https://github.com/nlohmann/json", "3.11.2", {.validators = &store});
+ * // result.notModified == true if GitHub answered 304 Not Modified
+ * ```
+ */
+inline UpdateInfo check_github_update(
+    std::string_view repoUrl,
+    std::string_view localVersion,
+    const CheckOptions& options
+) {
+    Client client(nullptr, /*abortAfterTag=*/true);
+    return client.check(repoUrl, localVersion, options);
 }
 
 // ---------------------------------------------------------
@@ -332,4 +2099,166 @@ inline std::future<UpdateInfo> check_github_update_async(
     });
 }
 
+/*!
+ * @brief Checks for updates on a GitHub repository (asynchronous, cancellable)
+ *
+ * Same as check_github_update_async(repoUrl, localVersion), but the check
+ * observes @p stop: once stop is requested the transfer is aborted within
+ * milliseconds and the future becomes ready with a "Check cancelled"
+ * exception, so destroying it no longer blocks for a full network timeout.
+ *
+ * @param repoUrl GitHub repository URL or API URL (ownership transferred)
+ * @param localVersion Local version string (ownership transferred)
+ * @param stop Token cancelling the check
+ *
+ * @return std::future<UpdateInfo> that resolves to the update check result
+ *
+ * @example
+ * ```cpp
+ * std::stop_source shutdown;
+ * auto future = ghupdate::check_github_update_async(url, "3.11.2", shutdown.get_token());
+ * // ... application exits early ...
+ * shutdown.request_stop();  // future is ready almost immediately
+ * ```
+ */
+inline std::future<UpdateInfo> check_github_update_async(
+    std::string repoUrl,
+    std::string localVersion,
+    std::stop_token stop
+) {
+    return std::async(std::launch::async, [repoUrl, localVersion, stop] {
+        return check_github_update(repoUrl, localVersion, CheckOptions{.stopToken = stop});
+    });
+}
+
+// ---------------------------------------------------------
+// Batch version checking with a bounded worker pool
+// ---------------------------------------------------------
+
+/*!
+ * @struct RepoCheck
+ * @brief A single (repository, local version) pair for batch checking
+ */
+struct RepoCheck {
+    std::string repoUrl;       ///< GitHub repository URL or API URL
+    std::string localVersion;  ///< Local version string (SemVer)
+    std::chrono::system_clock::time_point lastChecked{};  ///< When the cached result was obtained; oldest go first
+};
+
+/*!
+ * @brief Outcome of one check in a batch: UpdateInfo or the error message
+ */
+using CheckResult = std::expected<UpdateInfo, std::string>;
+
+/*!
+ * @struct BatchOptions
+ * @brief Tuning parameters for check_github_updates()
+ */
+struct BatchOptions {
+    std::size_t concurrency = 8;  ///< Maximum number of checks running at once (0 is treated as 1)
+    CheckOptions check{};         ///< Options applied to every check of the batch
+
+    /*!
+     * Called with the input index, result and wall-clock duration of each
+     * check as soon as it completes, e.g. to stream results. Calls come
+     * from the worker threads but are serialized; exceptions escaping it
+     * are swallowed.
+     */
+    std::function<void(std::size_t index, const CheckResult& result,
+                       std::chrono::steady_clock::duration elapsed)> onComplete{};
+};
+
+/*!
+ * @brief Checks many GitHub repositories for updates on a fixed-size worker pool
+ *
+ * Runs the check for every entry of @p repos using at most
+ * @p options.concurrency threads (the calling thread included), so the
+ * number of threads and curl handles stays bounded regardless of how many
+ * repositories are checked. Each worker owns one Client and all workers
+ * share a SharedCache, so connections and TLS sessions are reused across
+ * the whole batch. Errors are captured per entry and never abort the
+ * remaining checks.
+ *
+ * Checks are started in order of RepoCheck::lastChecked, oldest first, so
+ * the most outdated results are refreshed first when a RateLimitScheduler
+ * in @p options.check delays or stops the batch. The scheduler is told the
+ * size of the batch up front.
+ *
+ * @param repos Repositories and local versions to check
+ * @param options Batch tuning parameters
+ *
+ * @return One CheckResult per input entry, in input order
+ *
+ * @example
+ * ```cpp
+ * std::vector<ghupdate::RepoCheck> repos = {
+ *     {"https://github.com/nlohmann/json", "3.11.2"},
+ *     {"https://github.com/curl/curl", "8.7.0"},
+ * };
+ * auto results = ghupdate::check_github_updates(repos, {.concurrency = 16});
+ * for (std::size_t i = 0; i < results.size(); ++i) {
+ *     if (results[i])
+ *         std::println("{}: {}", repos[i].repoUrl, results[i]->latestVersion);
+ *     else
+ *         std::println("{}: error: {}", repos[i].repoUrl, results[i].error());
+ * }
+ * ```
+ */
+inline std::vector<CheckResult> check_github_updates(
+    std::span<const RepoCheck> repos,
+    const BatchOptions& options = {}
+) {
+    std::vector<CheckResult> results(repos.size());
+    if (repos.empty())
+        return results;
+
+    auto cache = std::make_shared<SharedCache>();
+
+    std::vector<std::size_t> order(repos.size());
+    for (std::size_t i = 0; i < order.size(); ++i)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return repos[a].lastChecked < repos[b].lastChecked;
+    });
+    if (options.check.scheduler)
+        options.check.scheduler->expect(repos.size());
+
+    std::mutex completeMutex;
+    std::atomic<std::size_t> next{0};
+    auto worker = [&] {
+        std::optional<Client> client;
+        for (std::size_t n = next++; n < repos.size(); n = next++) {
+            const std::size_t i = order[n];
+            const auto started = std::chrono::steady_clock::now();
+            try {
+                if (!client)
+                    client.emplace(cache);
+                results[i] = client->check(repos[i].repoUrl, repos[i].localVersion, options.check);
+            } catch (const std::exception& e) {
+                results[i] = std::unexpected(std::string(e.what()));
+            }
+
+            if (options.onComplete) {
+                std::lock_guard lock(completeMutex);
+                try {
+                    options.onComplete(i, results[i], std::chrono::steady_clock::now() - started);
+                } catch (...) {
+                    // A failing consumer must not abort the remaining checks
+                }
+            }
+        }
+    };
+
+    std::size_t workers = std::clamp<std::size_t>(options.concurrency, 1, repos.size());
+    {
+        std::vector<std::jthread> pool;
+        pool.reserve(workers - 1);
+        for (std::size_t w = 1; w < workers; ++w)
+            pool.emplace_back(worker);
+        worker();
+    }
+
+    return results;
+}
+
 } // namespace ghupdate
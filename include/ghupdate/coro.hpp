@@ -0,0 +1,126 @@
+/*!
+ * @file coro.hpp
+ * @brief C++20 coroutine API on top of MultiEngine
+ *
+ * A std::future from check_github_update_async() can only be consumed by
+ * blocking a thread on get(). check_github_update_co() returns an awaitable
+ * instead: the awaiting coroutine is suspended while MultiEngine's
+ * non-blocking curl_multi reactor performs the check, and is resumed with
+ * the result once it completes. Thousands of checks can be awaited
+ * concurrently without a thread per check.
+ *
+ * By default the coroutine is resumed directly on the engine's event-loop
+ * thread. Pass an executor to resume it elsewhere (e.g. the application's
+ * own thread pool or event loop); it is called with the coroutine handle
+ * and must eventually call resume() on it. An executor that throws (e.g. a
+ * pool that is shutting down) must not have scheduled the handle; the
+ * coroutine is then resumed inline and co_await rethrows the exception.
+ *
+ * @example
+ * ```cpp
+ * ghupdate::MultiEngine engine;
+ *
+ * my_task<void> refresh(ghupdate::MultiEngine& engine) {
+ *     auto info = co_await ghupdate::check_github_update_co(
+ *         engine, "https://github.com/nlohmann/json", "3.11.2",
+ *         [&](std::coroutine_handle<> h) { my_executor.post(h); });
+ *     if (info.hasUpdate)
+ *         std::println("latest: {}", info.latestVersion);
+ * }
+ * ```
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <ghupdate/multi_engine.hpp>
+#include <coroutine>
+#include <exception>
+#include <functional>
+
+namespace ghupdate {
+
+/*!
+ * @brief Schedules the resumption of a suspended coroutine
+ *
+ * An empty executor resumes the coroutine inline on the event-loop thread,
+ * and so does an executor that throws.
+ */
+using CoroutineExecutor = std::function<void(std::coroutine_handle<>)>;
+
+/*!
+ * @class CheckAwaitable
+ * @brief Awaitable update check performed by a MultiEngine
+ *
+ * Created by check_github_update_co(). The check is submitted when the
+ * awaitable is co_awaited; co_await yields the UpdateInfo or throws
+ * std::runtime_error with the check's error message.
+ */
+class CheckAwaitable {
+public:
+    CheckAwaitable(MultiEngine& engine, std::string repoUrl, std::string localVersion,
+                   CoroutineExecutor executor = {})
+        : engine_(engine),
+          repoUrl_(std::move(repoUrl)),
+          localVersion_(std::move(localVersion)),
+          executor_(std::move(executor)) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        // The callback may run (and resume the coroutine) on the loop thread
+        // before submit() returns, so nothing may touch *this afterwards
+        engine_.submit(std::move(repoUrl_), std::move(localVersion_),
+                       [this, handle](CheckResult result) {
+                           result_ = std::move(result);
+                           if (executor_) {
+                               try {
+                                   executor_(handle);
+                                   return;
+                               } catch (...) {
+                                   // Resume inline instead of leaking the suspended frame
+                                   executorError_ = std::current_exception();
+                               }
+                           }
+                           handle.resume();
+                       });
+    }
+
+    UpdateInfo await_resume() {
+        if (executorError_)
+            std::rethrow_exception(executorError_);
+        if (!result_)
+            throw std::runtime_error(result_.error());
+        return std::move(*result_);
+    }
+
+private:
+    MultiEngine& engine_;
+    std::string repoUrl_;
+    std::string localVersion_;
+    CoroutineExecutor executor_;
+    CheckResult result_ = std::unexpected(std::string("not completed"));
+    std::exception_ptr executorError_;
+};
+
+/*!
+ * @brief Checks for updates on a GitHub repository (awaitable)
+ *
+ * @param engine Engine whose event loop performs the check
+ * @param repoUrl GitHub repository URL or API URL
+ * @param localVersion Local version string (SemVer)
+ * @param executor Where to resume the awaiting coroutine; inline on the
+ *        event-loop thread if empty
+ * @return Awaitable yielding the UpdateInfo
+ *
+ * @note The engine must outlive the co_await.
+ */
+inline CheckAwaitable check_github_update_co(MultiEngine& engine, std::string repoUrl,
+                                             std::string localVersion, CoroutineExecutor executor = {}) {
+    return CheckAwaitable(engine, std::move(repoUrl), std::move(localVersion), std::move(executor));
+}
+
+} // namespace ghupdate
@@ -0,0 +1,271 @@
+/*!
+ * @file disk_cache.hpp
+ * @brief On-disk cache of latest release tags shared between processes
+ *
+ * Build scripts often run gh-update-checker for the same repository many
+ * times within minutes. DiskCache stores the latest release tag of each
+ * repository (keyed by its canonical "owner/repo" slug) in a small file
+ * below a cache directory, so later invocations can answer without any
+ * network I/O while the entry is fresh.
+ *
+ * Entries are written to a temporary file and renamed into place, so
+ * concurrent readers in other processes only ever see complete entries.
+ * An optional stale-while-revalidate window allows serving an expired entry
+ * while exactly one process (the one that wins the revalidation claim)
+ * refreshes it.
+ *
+ * @example
+ * ```cpp
+ * ghupdate::DiskCache cache(ghupdate::DiskCache::default_directory(),
+ *                           std::chrono::minutes(10));
+ * auto key = ghupdate::github_repo_slug("https://github.com/nlohmann/json");
+ * auto hit = cache.lookup(key);
+ * if (hit.state == ghupdate::DiskCache::State::Fresh)
+ *     std::println("cached: {}", hit.latestVersion);
+ * ```
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace ghupdate {
+
+/*!
+ * @class DiskCache
+ * @brief File-per-repository cache of release tags with TTL and stale-while-revalidate
+ */
+class DiskCache {
+public:
+    /*!
+     * @brief Freshness of a looked-up entry
+     */
+    enum class State {
+        Miss,   ///< No usable entry (absent, corrupt or older than TTL + stale window)
+        Fresh,  ///< Entry younger than the TTL; use it without network I/O
+        Stale,  ///< Entry within the stale-while-revalidate window; usable but should be refreshed
+    };
+
+    /*!
+     * @struct Lookup
+     * @brief Result of DiskCache::lookup()
+     */
+    struct Lookup {
+        State state = State::Miss;   ///< Freshness of the entry
+        std::string latestVersion;   ///< Cached release tag (empty on Miss)
+        std::chrono::seconds age{0}; ///< Age of the entry
+    };
+
+    /*!
+     * @brief Creates a cache rooted at a directory
+     *
+     * @param directory Cache directory; created on the first store()
+     * @param ttl Time during which an entry is served as Fresh
+     * @param staleWhileRevalidate Additional time during which an expired
+     *        entry is still served as Stale
+     */
+    DiskCache(std::filesystem::path directory,
+              std::chrono::seconds ttl,
+              std::chrono::seconds staleWhileRevalidate = std::chrono::seconds{0})
+        : directory_(std::move(directory)), ttl_(ttl), stale_(staleWhileRevalidate) {}
+
+    /*!
+     * @brief Default cache directory
+     *
+     * $XDG_CACHE_HOME/gh-update-checker, ~/.cache/gh-update-checker,
+     * %LOCALAPPDATA%\\gh-update-checker or the system temp directory, in
+     * that order of preference.
+     */
+    static std::filesystem::path default_directory() {
+        if (const char* xdg = std::getenv("XDG_CACHE_HOME"); xdg && *xdg)
+            return std::filesystem::path(xdg) / "gh-update-checker";
+        if (const char* home = std::getenv("HOME"); home && *home)
+            return std::filesystem::path(home) / ".cache" / "gh-update-checker";
+        if (const char* local = std::getenv("LOCALAPPDATA"); local && *local)
+            return std::filesystem::path(local) / "gh-update-checker";
+        return std::filesystem::temp_directory_path() / "gh-update-checker";
+    }
+
+    /*!
+     * @brief Looks up the cached release tag of a repository
+     *
+     * Performs a single small file read; never touches the network.
+     *
+     * @param key Canonical "owner/repo" slug
+     * @return Lookup with the entry's freshness and tag
+     * @throws std::runtime_error if @p key is not an "owner/repo" slug
+     */
+    Lookup lookup(std::string_view key) const {
+        Lookup result;
+        std::ifstream in(entry_path(key));
+        if (!in)
+            return result;
+
+        long long fetchedAt = 0;
+        std::string tag;
+        if (!(in >> fetchedAt) || !(in >> tag) || tag.empty())
+            return result;
+
+        auto now = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch());
+        result.age = std::max(now - std::chrono::seconds{fetchedAt}, std::chrono::seconds{0});
+
+        if (result.age < ttl_)
+            result.state = State::Fresh;
+        else if (result.age < ttl_ + stale_)
+            result.state = State::Stale;
+        else
+            return result;
+
+        result.latestVersion = std::move(tag);
+        return result;
+    }
+
+    /*!
+     * @brief Stores the latest release tag of a repository
+     *
+     * The entry is written to a uniquely named temporary file and renamed
+     * over the previous one, which is atomic for concurrent readers.
+     *
+     * @param key Canonical "owner/repo" slug
+     * @param latestVersion Release tag to cache
+     * @throws std::filesystem::filesystem_error if the entry cannot be written
+     * @throws std::runtime_error if @p key is not an "owner/repo" slug
+     */
+    void store(std::string_view key, std::string_view latestVersion) const {
+        auto path = entry_path(key);
+        std::filesystem::create_directories(path.parent_path());
+
+        auto tmp = path;
+        tmp += ".tmp" + std::to_string(std::random_device{}());
+        {
+            std::ofstream out(tmp, std::ios::trunc);
+            auto now = std::chrono::duration_cast<std::chrono::seconds>(
+                std::chrono::system_clock::now().time_since_epoch());
+            out << now.count() << '\n' << latestVersion << '\n';
+            if (!out) {
+                std::error_code ignored;
+                std::filesystem::remove(tmp, ignored);
+                throw std::filesystem::filesystem_error("Cannot write cache entry", tmp,
+                                                        std::make_error_code(std::errc::io_error));
+            }
+        }
+        std::filesystem::rename(tmp, path);
+    }
+
+    /*!
+     * @brief Tries to become the single process that revalidates an entry
+     *
+     * Creates a lock file exclusively. Claims older than the lock timeout
+     * (left behind by a crashed process) are broken automatically; breaking
+     * is serialized by a second lock file, so of several processes that all
+     * find the same stale claim exactly one wins.
+     *
+     * @param key Canonical "owner/repo" slug
+     * @return true if the caller should revalidate and then call release_revalidation()
+     */
+    bool try_claim_revalidation(std::string_view key) const {
+        auto lock = lock_path(key);
+        std::error_code ec;
+        std::filesystem::create_directories(lock.parent_path(), ec);
+
+        if (create_exclusive(lock))
+            return true;
+        if (!is_stale(lock))
+            return false;
+
+        // Removing the stale claim and creating the new one must not
+        // interleave with another breaker, which could otherwise delete the
+        // claim this process has just created
+        auto breaker = lock;
+        breaker += ".break";
+        if (is_stale(breaker))
+            std::filesystem::remove(breaker, ec);  // left behind by a crash while breaking
+        if (!create_exclusive(breaker))
+            return false;
+
+        bool claimed = false;
+        if (is_stale(lock)) {
+            std::filesystem::remove(lock, ec);
+            claimed = create_exclusive(lock);
+        }
+        std::filesystem::remove(breaker, ec);
+        return claimed;
+    }
+
+    /*!
+     * @brief Releases a claim obtained by try_claim_revalidation()
+     * @param key Canonical "owner/repo" slug
+     */
+    void release_revalidation(std::string_view key) const {
+        std::error_code ignored;
+        std::filesystem::remove(lock_path(key), ignored);
+    }
+
+    /*!
+     * @brief Directory this cache stores its entries in
+     */
+    const std::filesystem::path& directory() const { return directory_; }
+
+private:
+    static constexpr std::chrono::seconds kLockTimeout{60};
+
+    static bool create_exclusive(const std::filesystem::path& path) {
+        std::FILE* file = std::fopen(path.string().c_str(), "wx");
+        if (!file)
+            return false;
+        std::fclose(file);
+        return true;
+    }
+
+    static bool is_stale(const std::filesystem::path& lock) {
+        std::error_code ec;
+        auto written = std::filesystem::last_write_time(lock, ec);
+        return !ec && std::filesystem::file_time_type::clock::now() - written > kLockTimeout;
+    }
+
+    // Keys become paths below directory_, so only "owner/repo" slugs made of
+    // the characters GitHub allows in names are accepted; ".." or further
+    // separators would let a crafted URL write outside the cache directory
+    static std::string checked_key(std::string_view key) {
+        auto valid = [](std::string_view name) {
+            return !name.empty() && name != "." && name != ".." &&
+                   std::all_of(name.begin(), name.end(), [](char c) {
+                       return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+                              c == '-' || c == '_' || c == '.';
+                   });
+        };
+        auto slash = key.find('/');
+        if (slash == std::string_view::npos || !valid(key.substr(0, slash)) || !valid(key.substr(slash + 1)))
+            throw std::runtime_error("Invalid cache key: " + std::string(key));
+        return std::string(key);
+    }
+
+    std::filesystem::path entry_path(std::string_view key) const {
+        return directory_ / (checked_key(key) + ".cache");
+    }
+
+    std::filesystem::path lock_path(std::string_view key) const {
+        return directory_ / (checked_key(key) + ".lock");
+    }
+
+    std::filesystem::path directory_;
+    std::chrono::seconds ttl_;
+    std::chrono::seconds stale_;
+};
+
+} // namespace ghupdate
@@ -0,0 +1,260 @@
+/*!
+ * @file git_refs.hpp
+ * @brief Latest version tag via the git smart-HTTP protocol (ls-refs)
+ *
+ * The REST `/releases/latest` endpoint counts against the API rate limit and
+ * only knows about published releases, not repositories that just push
+ * tags. This backend asks the git server itself: a single git protocol v2
+ * `ls-refs` command restricted to `refs/tags/` returns one short pkt-line
+ * per tag. The reply is parsed incrementally while it streams in and the
+ * highest SemVer tag is selected. Git hosting traffic does not consume the
+ * GitHub API quota.
+ *
+ * @example
+ * ```cpp
+ * auto info = ghupdate::check_github_update_git("https://github.com/nlohmann/json", "3.11.2");
+ * if (info.hasUpdate)
+ *     std::println("newest tag: {}", info.latestVersion);
+ * ```
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <check_gh-update.hpp>
+
+namespace ghupdate {
+
+/*!
+ * @struct GitRefsOptions
+ * @brief Options of the git ls-refs backend
+ */
+struct GitRefsOptions {
+    std::string host = "https://github.com";  ///< Git host serving "<host>/<owner>/<repo>.git"
+    bool includePrereleases = false;          ///< Consider tags such as "v2.0.0-rc.1"
+};
+
+/*!
+ * @class LsRefsTagScanner
+ * @brief Incremental pkt-line parser selecting the highest SemVer tag
+ *
+ * Consumes the response of an `ls-refs` command chunk by chunk. Each data
+ * pkt-line has the form "<oid> refs/tags/<name>[ <attribute>...]"; names
+ * that contain no version and peeled entries ("^{}") are skipped. Only the
+ * best tag so far and at most one partial pkt-line are kept in memory.
+ */
+class LsRefsTagScanner {
+public:
+    explicit LsRefsTagScanner(bool includePrereleases = false)
+        : includePrereleases_(includePrereleases) {}
+
+    /*!
+     * @brief Feeds the next chunk of the response body
+     *
+     * @param chunk Next bytes of the body, in order
+     * @return true once the terminating flush-pkt (or an error) was seen
+     */
+    bool feed(std::string_view chunk) {
+        while (!chunk.empty() && !done_) {
+            const std::size_t want = readingHeader_ ? 4 : payloadLength_;
+
+            // Complete units are processed in place; only split ones are copied
+            std::string_view unit;
+            if (partial_.empty() && chunk.size() >= want) {
+                unit = chunk.substr(0, want);
+                chunk.remove_prefix(want);
+            } else {
+                std::size_t take = std::min(want - partial_.size(), chunk.size());
+                partial_.append(chunk.substr(0, take));
+                chunk.remove_prefix(take);
+                if (partial_.size() < want)
+                    break;
+                unit = partial_;
+            }
+
+            if (readingHeader_)
+                header(unit);
+            else
+                line(unit);
+            partial_.clear();
+        }
+        return done_;
+    }
+
+    /*!
+     * @brief true once the reply has been read completely or failed
+     */
+    bool done() const { return done_; }
+
+    /*!
+     * @brief Highest tag found so far, if any
+     */
+    const std::optional<std::string>& tag() const { return tag_; }
+
+    /*!
+     * @brief Error reported by the server ("ERR" pkt-line) or a framing error
+     */
+    const std::optional<std::string>& error() const { return error_; }
+
+    /*!
+     * @brief Returns the highest tag or throws
+     *
+     * A reply that ended before its flush-pkt is an error: the missing
+     * tail may hold a higher tag than the best one seen.
+     *
+     * @return Name of the highest SemVer tag (without "refs/tags/")
+     * @throws std::runtime_error "git error: <message>" on a server or
+     *         protocol error or a truncated reply, "No version tag found"
+     *         if no tag matched
+     */
+    std::string tag_or_throw() const {
+        if (error_)
+            throw std::runtime_error("git error: " + *error_);
+        if (!done_)
+            throw std::runtime_error("git error: truncated ls-refs response");
+        if (!tag_)
+            throw std::runtime_error("No version tag found");
+        return *tag_;
+    }
+
+private:
+    void header(std::string_view hex) {
+        std::size_t length = 0;
+        for (char c : hex) {
+            std::size_t digit = 0;
+            if (c >= '0' && c <= '9') digit = static_cast<std::size_t>(c - '0');
+            else if (c >= 'a' && c <= 'f') digit = static_cast<std::size_t>(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') digit = static_cast<std::size_t>(c - 'A' + 10);
+            else return fail("invalid pkt-line length");
+            length = length * 16 + digit;
+        }
+
+        if (length == 0) {
+            done_ = true;  // flush-pkt terminates the ls-refs reply
+        } else if (length == 1 || length == 2) {
+            // delim-pkt / response-end-pkt carry no payload
+        } else if (length < 4) {
+            fail("invalid pkt-line length");
+        } else if (length > 4) {
+            payloadLength_ = length - 4;
+            readingHeader_ = false;
+        }
+    }
+
+    void line(std::string_view payload) {
+        readingHeader_ = true;
+        if (payload.ends_with('\n'))
+            payload.remove_suffix(1);
+
+        if (payload.starts_with("ERR ")) {
+            fail(std::string(payload.substr(4)));
+            return;
+        }
+
+        // "<oid> <refname>[ <attribute>...]"
+        std::size_t nameStart = payload.find(' ');
+        if (nameStart == std::string_view::npos)
+            return;
+        std::string_view ref = payload.substr(nameStart + 1);
+        ref = ref.substr(0, ref.find(' '));
+
+        constexpr std::string_view prefix = "refs/tags/";
+        if (!ref.starts_with(prefix) || ref.ends_with("^{}"))
+            return;
+        std::string_view name = ref.substr(prefix.size());
+
+        std::optional<SemVer> version;
+        try {
+            version = SemVer::try_parse(name);
+        } catch (const std::exception&) {
+            return;  // overflowing versions are not candidates
+        }
+        if (!version || (version->is_prerelease() && !includePrereleases_))
+            return;
+        if (!tag_ || *version > best_) {
+            best_ = *version;
+            tag_ = std::string(name);
+        }
+    }
+
+    void fail(std::string message) {
+        error_ = std::move(message);
+        done_ = true;
+    }
+
+    std::optional<std::string> tag_;
+    std::optional<std::string> error_;
+    std::string partial_;
+    SemVer best_;
+    std::size_t payloadLength_ = 0;
+    bool readingHeader_ = true;
+    bool includePrereleases_ = false;
+    bool done_ = false;
+};
+
+/*!
+ * @brief Finds the highest SemVer tag of a repository via git ls-refs
+ *
+ * Sends one git protocol v2 request ("command=ls-refs" with
+ * "ref-prefix refs/tags/") to "<host>/<owner>/<repo>.git/git-upload-pack"
+ * over @p client and parses the reply while it streams in.
+ *
+ * @param client Client whose connection is used
+ * @param repoUrl GitHub repository URL or API URL
+ * @param options Git host and tag selection
+ * @return Name of the highest version tag
+ * @throws std::runtime_error on invalid URLs, network or protocol errors,
+ *         or if the repository has no version tag
+ */
+inline std::string latest_git_tag(Client& client, std::string_view repoUrl,
+                                  const GitRefsOptions& options = {}) {
+    std::string url = options.host + "/" + github_repo_slug(repoUrl) + ".git/git-upload-pack";
+
+    static const std::string request =
+        "0014command=ls-refs\n"
+        "0001"
+        "001aref-prefix refs/tags/\n"
+        "0000";
+    static const std::string headers[] = {
+        "Git-Protocol: version=2",
+        "Content-Type: application/x-git-upload-pack-request",
+        "Accept: application/x-git-upload-pack-result",
+    };
+
+    LsRefsTagScanner scanner(options.includePrereleases);
+    HttpResponse response = client.post(url, request, headers, [&](std::string_view chunk) {
+        scanner.feed(chunk);
+        return true;  // drain the reply so the connection stays reusable
+    });
+    if (response.status != 200)
+        throw std::runtime_error("git error: HTTP " + std::to_string(response.status));
+    return scanner.tag_or_throw();
+}
+
+/*!
+ * @brief Checks for updates using the repository's git tags (synchronous)
+ *
+ * Like check_github_update(), but compares against the highest SemVer tag
+ * reported by the git server instead of the latest GitHub release. Does not
+ * consume GitHub API quota and also works for repositories that only push
+ * tags.
+ *
+ * @param repoUrl GitHub repository URL or API URL
+ * @param localVersion Local version string (will be parsed as SemVer)
+ * @param options Git host and tag selection
+ * @return UpdateInfo with the comparison result
+ * @throws std::runtime_error on invalid URLs, versions, network or protocol errors
+ */
+inline UpdateInfo check_github_update_git(std::string_view repoUrl, std::string_view localVersion,
+                                          const GitRefsOptions& options = {}) {
+    SemVer local = SemVer::parse(localVersion);
+
+    Client client(nullptr);
+    std::string tag = latest_git_tag(client, repoUrl, options);
+    return {SemVer::parse(tag) > local, tag};
+}
+
+} // namespace ghupdate
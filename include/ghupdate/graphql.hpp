@@ -0,0 +1,235 @@
+/*!
+ * @file graphql.hpp
+ * @brief Batch update checks through the GitHub GraphQL API
+ *
+ * Every REST check costs one request against the 5,000 requests/hour rate
+ * limit. The GraphQL API resolves many repositories in a single POST by
+ * aliasing one `repository(owner:, name:) { latestRelease { tagName } }`
+ * field per repository, so a batch of N repositories needs only about
+ * N / 100 requests and round trips. The response is split back into one
+ * CheckResult per input entry.
+ *
+ * The GraphQL API always requires authentication; the token is taken from
+ * GraphQLOptions::token or the GITHUB_TOKEN environment variable.
+ *
+ * @example
+ * ```cpp
+ * std::vector<ghupdate::RepoCheck> repos = {
+ *     {"https://github.com/nlohmann/json", "3.11.2"},
+ *     {"https://github.com/curl/curl", "8.7.0"},
+ * };
+ * auto results = ghupdate::check_github_updates_graphql(repos);
+ * ```
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <check_gh-update.hpp>
+#include <cstdlib>
+#include <unordered_map>
+
+namespace ghupdate {
+
+/*!
+ * @struct GraphQLOptions
+ * @brief Endpoint, credentials and batch size for GraphQL checks
+ */
+struct GraphQLOptions {
+    std::string endpoint = "https://api.github.com/graphql";  ///< GraphQL endpoint (e.g. of GitHub Enterprise)
+    std::string token;                                        ///< API token; empty uses $GITHUB_TOKEN
+    std::size_t batchSize = 100;                              ///< Repositories per request (clamped to 1..100)
+};
+
+namespace graphql {
+
+/*!
+ * @struct RepoName
+ * @brief Owner and name of a repository as used in GraphQL queries
+ */
+struct RepoName {
+    std::string owner;  ///< Repository owner (user or organisation)
+    std::string name;   ///< Repository name
+};
+
+/// Latest release tag of one repository, or the error message
+using TagResult = std::expected<std::string, std::string>;
+
+/*!
+ * @brief Splits a repository URL into owner and name
+ *
+ * @param repoUrl GitHub repository URL or API URL
+ * @return Lower-cased owner and name
+ * @throws std::runtime_error if URL format is invalid
+ */
+inline RepoName repo_name(std::string_view repoUrl) {
+    std::string slug = github_repo_slug(repoUrl);
+    auto slash = slug.find('/');
+    return {slug.substr(0, slash), slug.substr(slash + 1)};
+}
+
+/*!
+ * @brief Builds the JSON request body resolving the latest release of @p repos
+ *
+ * Repository i is queried under the alias "r<i>".
+ *
+ * @param repos Repositories to resolve (at most 100 per GitHub's node limit)
+ * @return Request body of the form {"query": "..."}
+ */
+inline std::string build_query(std::span<const RepoName> repos) {
+    std::string query = "query{";
+    for (std::size_t i = 0; i < repos.size(); ++i) {
+        // JSON string literals are valid GraphQL string literals
+        query += 'r' + std::to_string(i) + ":repository(owner:" + nlohmann::json(repos[i].owner).dump() +
+                 ",name:" + nlohmann::json(repos[i].name).dump() + "){latestRelease{tagName}} ";
+    }
+    query += '}';
+    return nlohmann::json{{"query", std::move(query)}}.dump();
+}
+
+/*!
+ * @brief Splits a GraphQL response into per-repository results
+ *
+ * @param body Response body of a query created by build_query()
+ * @param count Number of repositories in that query
+ * @return One TagResult per repository, in query order
+ * @throws std::runtime_error if the body is not a GraphQL response or the
+ *         whole query failed (e.g. bad credentials)
+ */
+inline std::vector<TagResult> parse_response(std::string_view body, std::size_t count) {
+    nlohmann::json json = nlohmann::json::parse(body, nullptr, false);
+    if (json.is_discarded() || !json.is_object())
+        throw std::runtime_error("Invalid GraphQL response");
+
+    auto dataIt = json.find("data");
+    if (dataIt == json.end() || !dataIt->is_object()) {
+        if (auto msg = json.find("message"); msg != json.end() && msg->is_string())
+            throw std::runtime_error("GitHub API error: " + msg->get<std::string>());
+        auto errors = json.find("errors");
+        if (errors != json.end() && errors->is_array() && !errors->empty())
+            throw std::runtime_error("GitHub API error: " + (*errors)[0].value("message", std::string("unknown")));
+        throw std::runtime_error("Invalid GraphQL response");
+    }
+
+    // Per-alias errors, e.g. repositories that do not exist
+    std::unordered_map<std::string, std::string> aliasErrors;
+    if (auto errors = json.find("errors"); errors != json.end() && errors->is_array()) {
+        for (const auto& error : *errors) {
+            auto path = error.find("path");
+            if (path != error.end() && path->is_array() && !path->empty() && (*path)[0].is_string())
+                aliasErrors.emplace((*path)[0].get<std::string>(), error.value("message", std::string("unknown")));
+        }
+    }
+
+    std::vector<TagResult> results;
+    results.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string alias = 'r' + std::to_string(i);
+        auto repo = dataIt->find(alias);
+        if (repo == dataIt->end() || !repo->is_object()) {
+            auto error = aliasErrors.find(alias);
+            results.push_back(std::unexpected("GitHub API error: " +
+                                              (error != aliasErrors.end() ? error->second : "Not Found")));
+            continue;
+        }
+
+        auto release = repo->find("latestRelease");
+        if (release == repo->end() || !release->is_object()) {
+            results.push_back(std::unexpected(std::string("GitHub API error: Not Found")));
+            continue;
+        }
+
+        auto tag = release->find("tagName");
+        if (tag == release->end() || !tag->is_string()) {
+            results.push_back(std::unexpected(std::string("GitHub API returned no valid tag_name")));
+            continue;
+        }
+        results.push_back(tag->get<std::string>());
+    }
+    return results;
+}
+
+} // namespace graphql
+
+/*!
+ * @brief Checks many GitHub repositories with one GraphQL request per batch
+ *
+ * Repositories are de-duplicated, grouped into batches of
+ * @p options.batchSize and each batch is resolved with a single POST over
+ * one persistent connection. Errors (invalid URLs or versions, unknown
+ * repositories, failed requests) are captured per entry.
+ *
+ * @param repos Repositories and local versions to check
+ * @param options Endpoint, token and batch size
+ * @return One CheckResult per input entry, in input order
+ * @throws std::runtime_error if no token is configured
+ */
+inline std::vector<CheckResult> check_github_updates_graphql(std::span<const RepoCheck> repos,
+                                                             const GraphQLOptions& options = {}) {
+    std::string token = options.token;
+    if (token.empty()) {
+        if (const char* env = std::getenv("GITHUB_TOKEN"); env)
+            token = env;
+    }
+    if (token.empty())
+        throw std::runtime_error("GitHub GraphQL API requires a token (GraphQLOptions::token or GITHUB_TOKEN)");
+
+    std::vector<CheckResult> results(repos.size(), std::unexpected(std::string("not checked")));
+
+    // Map every entry to a unique repository
+    std::vector<graphql::RepoName> unique;
+    std::vector<std::size_t> uniqueOf(repos.size(), std::numeric_limits<std::size_t>::max());
+    std::unordered_map<std::string, std::size_t> indexOf;
+    for (std::size_t i = 0; i < repos.size(); ++i) {
+        try {
+            graphql::RepoName name = graphql::repo_name(repos[i].repoUrl);
+            auto [it, inserted] = indexOf.try_emplace(name.owner + '/' + name.name, unique.size());
+            if (inserted)
+                unique.push_back(std::move(name));
+            uniqueOf[i] = it->second;
+        } catch (const std::exception& e) {
+            results[i] = std::unexpected(std::string(e.what()));
+        }
+    }
+
+    std::vector<graphql::TagResult> tags;
+    tags.reserve(unique.size());
+    const std::size_t batchSize = std::clamp<std::size_t>(options.batchSize, 1, 100);
+    const std::string headers[] = {"Authorization: bearer " + token, "Content-Type: application/json"};
+
+    Client client;
+    for (std::size_t first = 0; first < unique.size(); first += batchSize) {
+        std::span<const graphql::RepoName> batch(unique.data() + first,
+                                                 std::min(batchSize, unique.size() - first));
+        try {
+            HttpResponse response = client.post(options.endpoint, graphql::build_query(batch), headers);
+            auto parsed = graphql::parse_response(response.body, batch.size());
+            tags.insert(tags.end(), std::make_move_iterator(parsed.begin()), std::make_move_iterator(parsed.end()));
+        } catch (const std::exception& e) {
+            tags.insert(tags.end(), batch.size(), std::unexpected(std::string(e.what())));
+        }
+    }
+
+    for (std::size_t i = 0; i < repos.size(); ++i) {
+        if (uniqueOf[i] == std::numeric_limits<std::size_t>::max())
+            continue;
+        const graphql::TagResult& tag = tags[uniqueOf[i]];
+        if (!tag) {
+            results[i] = std::unexpected(tag.error());
+            continue;
+        }
+        try {
+            SemVer local = SemVer::parse(repos[i].localVersion);
+            SemVer remote = SemVer::parse(*tag);
+            results[i] = UpdateInfo{remote > local, *tag};
+        } catch (const std::exception& e) {
+            results[i] = std::unexpected(std::string(e.what()));
+        }
+    }
+    return results;
+}
+
+} // namespace ghupdate
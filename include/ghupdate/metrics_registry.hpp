@@ -0,0 +1,263 @@
+/*!
+ * @file metrics_registry.hpp
+ * @brief Lock-free counters and latency histograms with OpenMetrics exposition
+ *
+ * A resident checker (watch mode, long batch runs) needs to be observable
+ * beyond its exit code. MetricsRegistry holds a fixed set of metrics that
+ * the check path updates through CheckOptions::metrics: HTTP requests,
+ * 304 Not Modified answers, retries, the last seen rate limit budget,
+ * check outcomes and one latency histogram per phase. Callers that answer
+ * from a cache count that in cacheHits themselves.
+ *
+ * Every update is a single relaxed atomic add or store; there are no locks,
+ * no allocations and no name lookups on the hot path. A scrape reads the
+ * atomics individually, so it is not an instantaneous snapshot across
+ * metrics, which Prometheus does not require.
+ *
+ * The registry renders itself in the OpenMetrics text format or the
+ * Prometheus 0.0.4 text format (as used by node_exporter's textfile
+ * collector), see exposition() and write_textfile().
+ *
+ * @example
+ * ```cpp
+ * ghupdate::MetricsRegistry metrics;
+ * auto results = ghupdate::check_github_updates(repos, {.check = {.metrics = &metrics}});
+ * metrics.write_textfile("/var/lib/node_exporter/textfile/gh_update_checker.prom");
+ * ```
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace ghupdate {
+
+/*!
+ * @class Counter
+ * @brief Monotonic lock-free counter
+ */
+class Counter {
+public:
+    void inc(std::uint64_t n = 1) noexcept { value_.fetch_add(n, std::memory_order_relaxed); }
+    std::uint64_t value() const noexcept { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<std::uint64_t> value_{0};
+};
+
+/*!
+ * @class Gauge
+ * @brief Lock-free gauge that may be unset
+ */
+class Gauge {
+public:
+    void set(std::int64_t value) noexcept {
+        value_.store(value, std::memory_order_relaxed);
+        set_.store(true, std::memory_order_relaxed);
+    }
+    bool has_value() const noexcept { return set_.load(std::memory_order_relaxed); }
+    std::int64_t value() const noexcept { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<std::int64_t> value_{0};
+    std::atomic<bool> set_{false};
+};
+
+/*!
+ * @class DurationHistogram
+ * @brief Lock-free histogram over fixed latency buckets from 1 ms to 30 s
+ */
+class DurationHistogram {
+public:
+    /// Upper bounds of the finite buckets; a final +Inf bucket catches the rest
+    static constexpr std::array<std::chrono::microseconds, 14> kBounds = {
+        std::chrono::microseconds(1'000),     std::chrono::microseconds(2'500),
+        std::chrono::microseconds(5'000),     std::chrono::microseconds(10'000),
+        std::chrono::microseconds(25'000),    std::chrono::microseconds(50'000),
+        std::chrono::microseconds(100'000),   std::chrono::microseconds(250'000),
+        std::chrono::microseconds(500'000),   std::chrono::microseconds(1'000'000),
+        std::chrono::microseconds(2'500'000), std::chrono::microseconds(5'000'000),
+        std::chrono::microseconds(10'000'000), std::chrono::microseconds(30'000'000),
+    };
+
+    void observe(std::chrono::microseconds value) noexcept {
+        std::size_t i = 0;
+        while (i < kBounds.size() && value > kBounds[i])
+            ++i;
+        buckets_[i].fetch_add(1, std::memory_order_relaxed);
+        sumMicros_.fetch_add(static_cast<std::uint64_t>(std::max<std::int64_t>(value.count(), 0)),
+                             std::memory_order_relaxed);
+    }
+
+    /// Observations in bucket @p i alone (not cumulative); index kBounds.size() is +Inf
+    std::uint64_t bucket(std::size_t i) const noexcept { return buckets_[i].load(std::memory_order_relaxed); }
+
+    /// Sum of all observations
+    std::chrono::microseconds sum() const noexcept {
+        return std::chrono::microseconds(sumMicros_.load(std::memory_order_relaxed));
+    }
+
+private:
+    std::array<std::atomic<std::uint64_t>, kBounds.size() + 1> buckets_{};
+    std::atomic<std::uint64_t> sumMicros_{0};
+};
+
+/*!
+ * @brief Phases with a latency histogram, see CheckMetrics
+ */
+enum class Phase : std::size_t {
+    Dns,
+    Connect,
+    Tls,
+    FirstByte,
+    Transfer,
+    TagParse,
+    SemverParse,
+    Wait,
+    Total,
+};
+
+/*!
+ * @class MetricsRegistry
+ * @brief Fixed set of checker metrics, updated lock-free and rendered on demand
+ */
+class MetricsRegistry {
+public:
+    /*!
+     * @brief Text format of exposition()
+     */
+    enum class Format {
+        OpenMetrics,  ///< application/openmetrics-text; version=1.0.0
+        Prometheus,   ///< text/plain; version=0.0.4 (textfile collector)
+    };
+
+    static constexpr std::size_t kPhases = static_cast<std::size_t>(Phase::Total) + 1;
+
+    Counter checksCurrent;       ///< Checks finding the local version up to date
+    Counter checksUpdate;        ///< Checks finding a newer release
+    Counter checkErrors;         ///< Checks that failed
+    Counter requests;            ///< HTTP request attempts
+    Counter notModified;         ///< 304 Not Modified answers
+    Counter retries;             ///< Attempts repeated after a transient failure
+    Counter cacheHits;           ///< Results answered from a cache without a request
+    Gauge rateLimitRemaining;    ///< Last X-RateLimit-Remaining seen
+    std::array<DurationHistogram, kPhases> phases;  ///< Latency per Phase
+
+    void observe(Phase phase, std::chrono::microseconds value) noexcept {
+        phases[static_cast<std::size_t>(phase)].observe(value);
+    }
+
+    /*!
+     * @brief Renders all metrics
+     *
+     * @param format OpenMetrics (ends with "# EOF") or Prometheus text format
+     */
+    std::string exposition(Format format = Format::OpenMetrics) const {
+        const bool om = format == Format::OpenMetrics;
+        std::string out;
+
+        auto header = [&](std::string_view name, std::string_view type, std::string_view help) {
+            out.append("# HELP ").append(name).append(" ").append(help).append("\n");
+            out.append("# TYPE ").append(name).append(" ").append(type).append("\n");
+        };
+        // OpenMetrics names a counter family without the _total suffix of its samples
+        auto counterHeader = [&](std::string_view family, std::string_view help) {
+            header(om ? std::string(family) : std::string(family) + "_total", "counter", help);
+        };
+        auto counter = [&](std::string_view family, std::string_view help, const Counter& c) {
+            counterHeader(family, help);
+            out.append(family).append("_total ").append(std::to_string(c.value())).append("\n");
+        };
+
+        counterHeader("ghupdate_checks", "Update checks by outcome.");
+        out += "ghupdate_checks_total{outcome=\"current\"} " + std::to_string(checksCurrent.value()) + '\n';
+        out += "ghupdate_checks_total{outcome=\"update\"} " + std::to_string(checksUpdate.value()) + '\n';
+        out += "ghupdate_checks_total{outcome=\"error\"} " + std::to_string(checkErrors.value()) + '\n';
+
+        counter("ghupdate_requests", "HTTP request attempts sent to GitHub.", requests);
+        counter("ghupdate_not_modified", "Requests answered with 304 Not Modified.", notModified);
+        counter("ghupdate_retries", "Requests repeated after a transient failure.", retries);
+        counter("ghupdate_cache_hits", "Results answered from a cache without a request.", cacheHits);
+
+        if (rateLimitRemaining.has_value()) {
+            header("ghupdate_rate_limit_remaining", "gauge", "Last X-RateLimit-Remaining reported by GitHub.");
+            out += "ghupdate_rate_limit_remaining " + std::to_string(rateLimitRemaining.value()) + '\n';
+        }
+
+        static constexpr const char* kPhaseNames[kPhases] = {
+            "dns", "connect", "tls", "first_byte", "transfer", "tag_parse", "semver_parse", "wait", "total",
+        };
+        header("ghupdate_phase_duration_seconds", "histogram", "Duration of the phases of update checks.");
+        for (std::size_t p = 0; p < kPhases; ++p) {
+            const DurationHistogram& h = phases[p];
+            const std::string label = std::string("phase=\"") + kPhaseNames[p] + '"';
+            std::uint64_t cumulative = 0;
+            for (std::size_t i = 0; i <= DurationHistogram::kBounds.size(); ++i) {
+                cumulative += h.bucket(i);
+                out += "ghupdate_phase_duration_seconds_bucket{" + label + ",le=\"" +
+                       (i < DurationHistogram::kBounds.size() ? seconds(DurationHistogram::kBounds[i]) : "+Inf") +
+                       "\"} " + std::to_string(cumulative) + '\n';
+            }
+            out += "ghupdate_phase_duration_seconds_sum{" + label + "} " + seconds(h.sum()) + '\n';
+            out += "ghupdate_phase_duration_seconds_count{" + label + "} " + std::to_string(cumulative) + '\n';
+        }
+
+        if (om)
+            out += "# EOF\n";
+        return out;
+    }
+
+    /*!
+     * @brief Atomically replaces @p path with the Prometheus text exposition
+     *
+     * Suitable for node_exporter's textfile collector, which must never see
+     * a partially written file.
+     *
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void write_textfile(const std::filesystem::path& path) const {
+        std::filesystem::path tmp = path;
+        tmp += ".tmp";
+        {
+            std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+            out << exposition(Format::Prometheus);
+            if (!out.flush())
+                throw std::runtime_error("Cannot write metrics file: " + tmp.string());
+        }
+        std::error_code ec;
+        std::filesystem::rename(tmp, path, ec);
+        if (ec) {
+            std::filesystem::remove(tmp, ec);
+            throw std::runtime_error("Cannot write metrics file: " + path.string());
+        }
+    }
+
+private:
+    // Microseconds as decimal seconds, e.g. 2500us -> "0.0025"
+    static std::string seconds(std::chrono::microseconds value) {
+        char text[32];
+        std::snprintf(text, sizeof text, "%.6f", static_cast<double>(value.count()) / 1e6);
+        std::string s = text;
+        s.erase(s.find_last_not_of('0') + 1);
+        if (s.back() == '.')
+            s.pop_back();
+        return s;
+    }
+};
+
+} // namespace ghupdate
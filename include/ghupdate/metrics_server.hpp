@@ -0,0 +1,202 @@
+/*!
+ * @file metrics_server.hpp
+ * @brief Minimal HTTP endpoint serving a MetricsRegistry on /metrics
+ *
+ * Lets Prometheus scrape a resident checker (e.g. `gh-update-checker
+ * --watch`) directly. The server runs one background thread that accepts
+ * a connection, answers a single GET request and closes it. That is all a
+ * scraper needs, and it keeps the server free of any dependency beyond
+ * POSIX sockets.
+ *
+ * Clients sending `Accept: application/openmetrics-text` get the OpenMetrics
+ * format, all others the Prometheus text format.
+ *
+ * @example
+ * ```cpp
+ * ghupdate::MetricsRegistry metrics;
+ * ghupdate::MetricsServer server(metrics, "127.0.0.1", 9464);
+ * // curl http://127.0.0.1:9464/metrics
+ * ```
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#if defined(_WIN32)
+#error "MetricsServer requires POSIX sockets; use MetricsRegistry::write_textfile() instead"
+#endif
+
+#include <ghupdate/metrics_registry.hpp>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <stop_token>
+#include <thread>
+
+namespace ghupdate {
+
+/*!
+ * @class MetricsServer
+ * @brief Serves the exposition of a MetricsRegistry over HTTP/1.1
+ *
+ * Listening starts in the constructor and stops in the destructor. The
+ * registry must outlive the server.
+ */
+class MetricsServer {
+public:
+    /*!
+     * @brief Binds and starts serving
+     *
+     * @param registry Metrics to serve
+     * @param host Address to listen on; keep the loopback default unless
+     *        the endpoint is meant to be reachable from other hosts
+     * @param port TCP port; 0 picks a free one, see port()
+     * @throws std::runtime_error if the address cannot be bound
+     */
+    explicit MetricsServer(const MetricsRegistry& registry, const std::string& host = "127.0.0.1",
+                           std::uint16_t port = 9464)
+        : registry_(registry) {
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_flags = AI_PASSIVE;
+        addrinfo* addresses = nullptr;
+        const std::string service = std::to_string(port);
+        if (int rc = getaddrinfo(host.empty() ? nullptr : host.c_str(), service.c_str(), &hints, &addresses); rc != 0)
+            throw std::runtime_error("Cannot resolve metrics address " + host + ": " + gai_strerror(rc));
+
+        int error = 0;
+        for (addrinfo* a = addresses; a && listen_ < 0; a = a->ai_next) {
+            int fd = ::socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+            if (fd < 0) {
+                error = errno;
+                continue;
+            }
+            int on = 1;
+            setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof on);
+            if (::bind(fd, a->ai_addr, a->ai_addrlen) == 0 && ::listen(fd, 16) == 0) {
+                listen_ = fd;
+            } else {
+                error = errno;
+                ::close(fd);
+            }
+        }
+        freeaddrinfo(addresses);
+        if (listen_ < 0)
+            throw std::runtime_error("Cannot listen for metrics on " + host + ":" + service + ": " +
+                                     std::strerror(error));
+
+        sockaddr_storage bound{};
+        socklen_t length = sizeof bound;
+        getsockname(listen_, reinterpret_cast<sockaddr*>(&bound), &length);
+        port_ = ntohs(bound.ss_family == AF_INET6 ? reinterpret_cast<sockaddr_in6*>(&bound)->sin6_port
+                                                  : reinterpret_cast<sockaddr_in*>(&bound)->sin_port);
+
+        thread_ = std::jthread([this](std::stop_token stop) { run(stop); });
+    }
+
+    ~MetricsServer() {
+        thread_.request_stop();
+        thread_.join();
+        ::close(listen_);
+    }
+
+    MetricsServer(const MetricsServer&) = delete;
+    MetricsServer& operator=(const MetricsServer&) = delete;
+
+    /*!
+     * @brief Port the server listens on
+     */
+    std::uint16_t port() const { return port_; }
+
+private:
+    void run(std::stop_token stop) {
+        pollfd pfd{listen_, POLLIN, 0};
+        while (!stop.stop_requested()) {
+            // Short timeout so the destructor's stop request is noticed promptly
+            if (::poll(&pfd, 1, 200) <= 0)
+                continue;
+            int client = ::accept(listen_, nullptr, nullptr);
+            if (client < 0)
+                continue;
+            serve(client);
+            ::close(client);
+        }
+    }
+
+    void serve(int client) const {
+        // A stalled client must not block the next scrape for long
+        timeval timeout{2, 0};
+        setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof timeout);
+        setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof timeout);
+
+        std::string request;
+        char buffer[2048];
+        while (request.find("\r\n\r\n") == std::string::npos && request.size() < 8192) {
+            ssize_t n = ::recv(client, buffer, sizeof buffer, 0);
+            if (n <= 0)
+                return;
+            request.append(buffer, static_cast<std::size_t>(n));
+        }
+
+        std::string_view line(request);
+        line = line.substr(0, line.find("\r\n"));
+        std::string_view method = line.substr(0, line.find(' '));
+        std::string_view target = line.substr(std::min(line.size(), method.size() + 1));
+        target = target.substr(0, target.find(' '));
+        target = target.substr(0, target.find('?'));
+
+        if (method != "GET" && method != "HEAD")
+            return respond(client, "405 Method Not Allowed", "text/plain", "Method Not Allowed\n", true);
+        if (target != "/metrics")
+            return respond(client, "404 Not Found", "text/plain", "Not Found\n", method == "GET");
+
+        std::string lower = request;
+        for (char& c : lower)
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        const bool om = lower.find("application/openmetrics-text") != std::string::npos;
+        respond(client, "200 OK",
+                om ? "application/openmetrics-text; version=1.0.0; charset=utf-8"
+                   : "text/plain; version=0.0.4; charset=utf-8",
+                registry_.exposition(om ? MetricsRegistry::Format::OpenMetrics : MetricsRegistry::Format::Prometheus),
+                method == "GET");
+    }
+
+    static void respond(int client, std::string_view status, std::string_view contentType,
+                        const std::string& body, bool withBody) {
+        std::string response = "HTTP/1.1 " + std::string(status) +
+                               "\r\nContent-Type: " + std::string(contentType) +
+                               "\r\nContent-Length: " + std::to_string(body.size()) +
+                               "\r\nConnection: close\r\n\r\n";
+        if (withBody)
+            response += body;
+
+#ifdef MSG_NOSIGNAL
+        constexpr int flags = MSG_NOSIGNAL;  // a scraper hanging up must not raise SIGPIPE
+#else
+        constexpr int flags = 0;
+#endif
+        for (std::size_t sent = 0; sent < response.size();) {
+            ssize_t n = ::send(client, response.data() + sent, response.size() - sent, flags);
+            if (n <= 0)
+                return;
+            sent += static_cast<std::size_t>(n);
+        }
+    }
+
+    const MetricsRegistry& registry_;
+    int listen_ = -1;
+    std::uint16_t port_ = 0;
+    std::jthread thread_;
+};
+
+} // namespace ghupdate
@@ -0,0 +1,390 @@
+/*!
+ * @file multi_engine.hpp
+ * @brief Event-loop driven update checks on top of the libcurl multi interface
+ *
+ * check_github_update() performs one blocking transfer per call, so running
+ * many checks at once needs one thread per request. MultiEngine instead keeps
+ * all in-flight transfers in a curl multi handle that is driven by a single
+ * event-loop thread (or a few loops, with requests sharded round-robin), and
+ * reports each result through a completion callback.
+ *
+ * Since every check targets api.github.com, each loop multiplexes its
+ * transfers as HTTP/2 streams over one or a few persistent connections by
+ * default. EngineStats reports how often connections were reused.
+ *
+ * Responses are evaluated like Client::latest_release(): error statuses are
+ * reported with GitHub's message (or the HTTP status). Of the CheckOptions
+ * only the connect and transfer timeouts are available, engine-wide through
+ * EngineOptions; retries, conditional requests, deadlines, stop tokens,
+ * metrics and custom transports are not supported.
+ *
+ * @example
+ * ```cpp
+ * ghupdate::MultiEngine engine;
+ * engine.submit("https://github.com/nlohmann/json", "3.11.2",
+ *     [](ghupdate::CheckResult r) {
+ *         if (r) std::println("latest: {}", r->latestVersion);
+ *     });
+ * engine.wait_idle();
+ * ```
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <check_gh-update.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace ghupdate {
+
+/*!
+ * @brief Completion callback for MultiEngine checks
+ *
+ * Invoked exactly once per submitted check on the event-loop thread that
+ * performed it. Callbacks should return quickly; exceptions escaping the
+ * callback are swallowed so that they cannot stop the loop.
+ */
+using CheckCallback = std::function<void(CheckResult)>;
+
+/*!
+ * @struct EngineOptions
+ * @brief Tuning parameters for MultiEngine
+ */
+struct EngineOptions {
+    std::size_t loops = 1;                ///< Number of event-loop threads (0 is treated as 1)
+    std::size_t maxInFlight = 256;        ///< Maximum concurrent transfers per loop
+    bool http2Multiplex = true;           ///< Multiplex transfers as HTTP/2 streams over shared connections
+    std::size_t maxHostConnections = 2;   ///< Connections per host and loop when multiplexing (0 = unlimited)
+    std::size_t maxStreamsPerConnection = 100;  ///< Concurrent HTTP/2 streams per connection
+    std::chrono::milliseconds connectTimeout = detail::kDefaultConnectTimeout;    ///< Connect limit of each transfer
+    std::chrono::milliseconds transferTimeout = detail::kDefaultTransferTimeout;  ///< Limit of each transfer (0 = none)
+};
+
+/*!
+ * @struct EngineStats
+ * @brief Connection usage counters of a MultiEngine
+ */
+struct EngineStats {
+    std::uint64_t transfers = 0;       ///< Successfully completed transfers
+    std::uint64_t newConnections = 0;  ///< Connections opened for those transfers
+    std::uint64_t http2Transfers = 0;  ///< Transfers that were carried over HTTP/2
+
+    /*!
+     * @brief Fraction of transfers that did not need a new connection
+     * @return Value in [0, 1]; 0 if no transfer has completed yet
+     */
+    double reuse_ratio() const {
+        if (transfers == 0)
+            return 0.0;
+        auto reused = transfers > newConnections ? transfers - newConnections : 0;
+        return static_cast<double>(reused) / static_cast<double>(transfers);
+    }
+};
+
+/*!
+ * @class MultiEngine
+ * @brief Runs many update checks concurrently on a few curl_multi event loops
+ *
+ * Submitted checks are queued and started as soon as their loop has a free
+ * transfer slot. Easy handles are recycled between transfers, so the memory
+ * footprint stays proportional to maxInFlight rather than to the number of
+ * submitted checks.
+ *
+ * The destructor stops all loops; checks that have not completed by then are
+ * reported to their callbacks as errors.
+ */
+class MultiEngine {
+public:
+    explicit MultiEngine(EngineOptions options = {}) {
+        detail::ensure_curl_initialized();
+        std::size_t count = std::max<std::size_t>(options.loops, 1);
+        loops_.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            loops_.push_back(std::make_unique<Loop>(options, *this));
+    }
+
+    ~MultiEngine() {
+        loops_.clear();
+    }
+
+    MultiEngine(const MultiEngine&) = delete;
+    MultiEngine& operator=(const MultiEngine&) = delete;
+
+    /*!
+     * @brief Queues an update check
+     *
+     * Unlike check_github_update() there are no per-check options; see the
+     * file documentation for what the engine supports.
+     *
+     * @param repoUrl GitHub repository URL or API URL
+     * @param localVersion Local version string (SemVer)
+     * @param callback Invoked with the result once the check completes
+     */
+    void submit(std::string repoUrl, std::string localVersion, CheckCallback callback) {
+        {
+            std::lock_guard lock(idleMutex_);
+            ++outstanding_;
+        }
+        Loop& loop = *loops_[next_++ % loops_.size()];
+        loop.enqueue(Job{std::move(repoUrl), std::move(localVersion), std::move(callback)});
+    }
+
+    /*!
+     * @brief Queues an update check and returns a future for its result
+     *
+     * @param repoUrl GitHub repository URL or API URL
+     * @param localVersion Local version string (SemVer)
+     * @return std::future<UpdateInfo> which rethrows errors as std::runtime_error
+     */
+    std::future<UpdateInfo> submit(std::string repoUrl, std::string localVersion) {
+        auto promise = std::make_shared<std::promise<UpdateInfo>>();
+        auto future = promise->get_future();
+        submit(std::move(repoUrl), std::move(localVersion), [promise](CheckResult result) {
+            if (result)
+                promise->set_value(std::move(*result));
+            else
+                promise->set_exception(std::make_exception_ptr(std::runtime_error(result.error())));
+        });
+        return future;
+    }
+
+    /*!
+     * @brief Returns connection usage counters accumulated over all loops
+     */
+    EngineStats stats() const {
+        return {transfers_.load(), newConnections_.load(), http2Transfers_.load()};
+    }
+
+    /*!
+     * @brief Blocks until every submitted check has completed
+     */
+    void wait_idle() {
+        std::unique_lock lock(idleMutex_);
+        idle_.wait(lock, [this] { return outstanding_ == 0; });
+    }
+
+private:
+    struct Job {
+        std::string repoUrl;
+        std::string localVersion;
+        CheckCallback callback;
+    };
+
+    struct Transfer {
+        Job job;
+        detail::TagSink sink;
+    };
+
+    class Loop {
+    public:
+        Loop(const EngineOptions& options, MultiEngine& engine)
+            : maxInFlight_(std::max<std::size_t>(options.maxInFlight, 1)),
+              http2_(options.http2Multiplex),
+              timeouts_{options.connectTimeout, options.transferTimeout},
+              engine_(engine),
+              multi_(curl_multi_init()) {
+            if (!multi_) throw std::runtime_error("curl multi init failed");
+            if (http2_) {
+                curl_multi_setopt(multi_, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+                curl_multi_setopt(multi_, CURLMOPT_MAX_HOST_CONNECTIONS,
+                                  static_cast<long>(options.maxHostConnections));
+                curl_multi_setopt(multi_, CURLMOPT_MAX_CONCURRENT_STREAMS,
+                                  static_cast<long>(options.maxStreamsPerConnection));
+            }
+            thread_ = std::jthread([this](std::stop_token stop) { run(stop); });
+        }
+
+        ~Loop() {
+            thread_.request_stop();
+            curl_multi_wakeup(multi_);
+            thread_.join();
+            for (CURL* easy : idleHandles_)
+                curl_easy_cleanup(easy);
+            curl_multi_cleanup(multi_);
+        }
+
+        void enqueue(Job job) {
+            {
+                std::lock_guard lock(mutex_);
+                pending_.push_back(std::move(job));
+            }
+            curl_multi_wakeup(multi_);
+        }
+
+    private:
+        void run(std::stop_token stop) {
+            while (!stop.stop_requested()) {
+                start_pending();
+
+                int running = 0;
+                curl_multi_perform(multi_, &running);
+                collect_finished();
+
+                curl_multi_poll(multi_, nullptr, 0, 1000, nullptr);
+            }
+
+            // Shutdown: fail everything still queued or in flight
+            std::deque<Job> pending;
+            {
+                std::lock_guard lock(mutex_);
+                pending.swap(pending_);
+            }
+            for (Job& job : pending)
+                finish(job, std::unexpected(std::string("MultiEngine stopped")));
+            for (auto& [easy, transfer] : active_) {
+                curl_multi_remove_handle(multi_, easy);
+                curl_easy_cleanup(easy);
+                finish(transfer->job, std::unexpected(std::string("MultiEngine stopped")));
+            }
+            active_.clear();
+        }
+
+        void start_pending() {
+            while (active_.size() < maxInFlight_) {
+                Job job;
+                {
+                    std::lock_guard lock(mutex_);
+                    if (pending_.empty())
+                        return;
+                    job = std::move(pending_.front());
+                    pending_.pop_front();
+                }
+
+                std::string_view apiUrl;
+                try {
+                    apiUrl = to_github_api_url_view(job.repoUrl);
+                } catch (const std::exception& e) {
+                    finish(job, std::unexpected(std::string(e.what())));
+                    continue;
+                }
+
+                CURL* easy = acquire_handle();
+                if (!easy) {
+                    finish(job, std::unexpected(std::string("curl init failed")));
+                    continue;
+                }
+
+                auto transfer = std::make_unique<Transfer>(Transfer{std::move(job), {}});
+                transfer->sink.abort = detail::TagSink::Abort::IfHttp2;
+                transfer->sink.easy = easy;
+                detail::configure_get(easy, apiUrl, nullptr, timeouts_);
+                curl_easy_setopt(easy, CURLOPT_WRITEFUNCTION, &detail::TagSink::write);
+                curl_easy_setopt(easy, CURLOPT_WRITEDATA, &transfer->sink);
+                if (http2_) {
+                    curl_easy_setopt(easy, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+                    // Wait for an existing connection to offer a stream instead of opening a new one
+                    curl_easy_setopt(easy, CURLOPT_PIPEWAIT, 1L);
+                }
+                curl_multi_add_handle(multi_, easy);
+                active_.emplace(easy, std::move(transfer));
+            }
+        }
+
+        void collect_finished() {
+            int queued = 0;
+            while (CURLMsg* msg = curl_multi_info_read(multi_, &queued)) {
+                if (msg->msg != CURLMSG_DONE)
+                    continue;
+
+                CURL* easy = msg->easy_handle;
+                CURLcode code = msg->data.result;
+                curl_multi_remove_handle(multi_, easy);
+
+                auto node = active_.extract(easy);
+                std::unique_ptr<Transfer> transfer = std::move(node.mapped());
+                bool ok = transfer->sink.succeeded(code);
+                long status = 0;
+                curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &status);
+                if (ok)
+                    engine_.record_transfer(easy);
+                release_handle(easy);
+
+                CheckResult result;
+                if (!ok) {
+                    result = std::unexpected(std::string("HTTP request failed"));
+                } else {
+                    try {
+                        std::string latest = release_tag(status, transfer->sink.extractor);
+                        SemVer local = SemVer::parse(transfer->job.localVersion);
+                        SemVer remote = SemVer::parse(latest);
+                        result = UpdateInfo{remote > local, std::move(latest)};
+                    } catch (const std::exception& e) {
+                        result = std::unexpected(std::string(e.what()));
+                    }
+                }
+                finish(transfer->job, std::move(result));
+            }
+        }
+
+        CURL* acquire_handle() {
+            if (idleHandles_.empty())
+                return curl_easy_init();
+            CURL* easy = idleHandles_.back();
+            idleHandles_.pop_back();
+            return easy;
+        }
+
+        void release_handle(CURL* easy) {
+            curl_easy_reset(easy);
+            idleHandles_.push_back(easy);
+        }
+
+        void finish(Job& job, CheckResult result) {
+            try {
+                if (job.callback)
+                    job.callback(std::move(result));
+            } catch (...) {
+                // A throwing callback must not take down the event loop
+            }
+            engine_.complete_one();
+        }
+
+        std::size_t maxInFlight_;
+        bool http2_;
+        detail::Timeouts timeouts_;
+        MultiEngine& engine_;
+        CURLM* multi_;
+        std::mutex mutex_;
+        std::deque<Job> pending_;
+        std::unordered_map<CURL*, std::unique_ptr<Transfer>> active_;
+        std::vector<CURL*> idleHandles_;
+        std::jthread thread_;
+    };
+
+    void record_transfer(CURL* easy) {
+        long connects = 0;
+        long version = 0;
+        curl_easy_getinfo(easy, CURLINFO_NUM_CONNECTS, &connects);
+        curl_easy_getinfo(easy, CURLINFO_HTTP_VERSION, &version);
+        transfers_.fetch_add(1, std::memory_order_relaxed);
+        newConnections_.fetch_add(static_cast<std::uint64_t>(connects), std::memory_order_relaxed);
+        if (version == CURL_HTTP_VERSION_2_0)
+            http2Transfers_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void complete_one() {
+        std::lock_guard lock(idleMutex_);
+        if (--outstanding_ == 0)
+            idle_.notify_all();
+    }
+
+    std::mutex idleMutex_;
+    std::condition_variable idle_;
+    std::size_t outstanding_ = 0;
+    std::atomic<std::size_t> next_{0};
+    std::atomic<std::uint64_t> transfers_{0};
+    std::atomic<std::uint64_t> newConnections_{0};
+    std::atomic<std::uint64_t> http2Transfers_{0};
+    std::vector<std::unique_ptr<Loop>> loops_;
+};
+
+} // namespace ghupdate
@@ -0,0 +1,188 @@
+/*!
+ * @file rate_limit.hpp
+ * @brief Pacing of GitHub API requests from X-RateLimit-* response headers
+ *
+ * GitHub reports the remaining request budget and the time it is refilled
+ * in every API response (`X-RateLimit-Remaining`, `X-RateLimit-Reset`) and
+ * asks clients to back off with `Retry-After` when a secondary limit is
+ * hit. Without using them a large batch just runs into
+ * "API rate limit exceeded" halfway through and wastes the remaining calls
+ * on failures.
+ *
+ * RateLimitScheduler is fed those headers and hands out send slots: while
+ * the announced demand fits into the remaining budget requests go out
+ * immediately, otherwise the budget is spread evenly until the reset time,
+ * and once it is exhausted callers wait for the reset instead of sending
+ * requests that are bound to fail.
+ *
+ * @example
+ * ```cpp
+ * ghupdate::RateLimitScheduler scheduler;
+ * auto results = ghupdate::check_github_updates(repos, {.check = {.scheduler = &scheduler}});
+ * ```
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <thread>
+
+namespace ghupdate {
+
+/*!
+ * @struct RateLimit
+ * @brief Rate limit state reported by one API response
+ */
+struct RateLimit {
+    std::optional<long> remaining{};                               ///< X-RateLimit-Remaining
+    std::optional<std::chrono::system_clock::time_point> reset{};  ///< X-RateLimit-Reset
+    std::optional<std::chrono::seconds> retryAfter{};              ///< Retry-After
+};
+
+/*!
+ * @struct RateLimitOptions
+ * @brief Tuning parameters for RateLimitScheduler
+ */
+struct RateLimitOptions {
+    long reserve = 0;                                      ///< Requests left untouched for other users of the token
+    std::chrono::seconds maxWait = std::chrono::hours(1);  ///< Longest a caller is made to wait before failing
+};
+
+/*!
+ * @class RateLimitScheduler
+ * @brief Thread-safe pacer that spreads the remaining API budget until its reset
+ *
+ * Share one scheduler between all checks that use the same token. Before
+ * the first response is seen nothing is known and requests are not
+ * delayed.
+ */
+class RateLimitScheduler {
+public:
+    using Clock = std::chrono::system_clock;
+
+    explicit RateLimitScheduler(RateLimitOptions options = {}) : options_(options) {}
+
+    RateLimitScheduler(const RateLimitScheduler&) = delete;
+    RateLimitScheduler& operator=(const RateLimitScheduler&) = delete;
+
+    /*!
+     * @brief Announces that @p requests more requests are about to be made
+     *
+     * Requests are only paced while the announced demand exceeds the
+     * remaining budget; without an announcement each request counts as a
+     * demand of one.
+     */
+    void expect(std::size_t requests) {
+        std::lock_guard lock(mutex_);
+        demand_ += requests;
+    }
+
+    /*!
+     * @brief Reserves the next send slot without waiting
+     *
+     * @return Time at which the caller may send its request
+     * @throws std::runtime_error if the slot is more than
+     *         RateLimitOptions::maxWait away
+     */
+    Clock::time_point reserve() {
+        std::lock_guard lock(mutex_);
+        const auto now = Clock::now();
+
+        // A new window has started; its budget is unknown until the next response
+        if (remaining_ && now >= reset_)
+            remaining_.reset();
+
+        auto at = std::max(now, blockedUntil_);
+        if (remaining_) {
+            long budget = *remaining_ - options_.reserve;
+            if (budget <= 0) {
+                at = std::max(at, reset_ + std::chrono::seconds(1));
+            } else {
+                if (demand_ > static_cast<std::size_t>(budget)) {
+                    at = std::max(at, nextSlot_);
+                    nextSlot_ = at + (reset_ - now) / budget;
+                }
+                --*remaining_;
+            }
+        }
+
+        if (at - now > options_.maxWait)
+            throw std::runtime_error("GitHub API rate limit exceeded; budget resets in " +
+                                     std::to_string(std::chrono::duration_cast<std::chrono::seconds>(at - now).count()) +
+                                     "s");
+        if (demand_ > 0)
+            --demand_;
+        return at;
+    }
+
+    /*!
+     * @brief Blocks until the next request may be sent
+     *
+     * @param stop Interrupts the wait when stop is requested
+     * @throws std::runtime_error if that is more than RateLimitOptions::maxWait
+     *         away, or "Check cancelled" if the wait was interrupted
+     */
+    void acquire(std::stop_token stop = {}) {
+        auto at = reserve();
+        if (!stop.stop_possible()) {
+            std::this_thread::sleep_until(at);
+            return;
+        }
+        std::mutex mutex;
+        std::condition_variable_any cv;
+        std::unique_lock lock(mutex);
+        cv.wait_until(lock, stop, at, [] { return false; });
+        if (stop.stop_requested())
+            throw std::runtime_error("Check cancelled");
+    }
+
+    /*!
+     * @brief Feeds the rate limit headers of a response
+     *
+     * @param limit Parsed X-RateLimit-* / Retry-After headers
+     * @param status HTTP status of the response
+     */
+    void update(const RateLimit& limit, long status) {
+        std::lock_guard lock(mutex_);
+        if (limit.remaining) {
+            // Responses of concurrent requests may arrive out of order; within
+            // one window the budget only ever decreases
+            bool sameWindow = remaining_ && limit.reset && *limit.reset == reset_;
+            remaining_ = sameWindow ? std::min(*remaining_, *limit.remaining) : *limit.remaining;
+            if (limit.reset)
+                reset_ = *limit.reset;
+        }
+        if ((status == 403 || status == 429) && limit.retryAfter)
+            blockedUntil_ = std::max(blockedUntil_, Clock::now() + *limit.retryAfter);
+    }
+
+    /*!
+     * @brief Estimated number of requests left in the current window, if known
+     */
+    std::optional<long> remaining() const {
+        std::lock_guard lock(mutex_);
+        return remaining_;
+    }
+
+private:
+    RateLimitOptions options_;
+    mutable std::mutex mutex_;
+    std::optional<long> remaining_;
+    Clock::time_point reset_{};
+    Clock::time_point blockedUntil_{};
+    Clock::time_point nextSlot_{};
+    std::size_t demand_ = 0;
+};
+
+} // namespace ghupdate
@@ -0,0 +1,261 @@
+/*!
+ * @file release_tag_extractor.hpp
+ * @brief Streaming extraction of tag_name from a /releases/latest response
+ *
+ * A GitHub release response carries the full release notes and the list of
+ * assets and easily reaches tens or hundreds of KB, while the checker only
+ * needs the top-level "tag_name" (and "message" for API errors).
+ * ReleaseTagExtractor scans the JSON incrementally as chunks arrive from the
+ * network, keeps only the two values of interest, and reports as soon as
+ * tag_name is known so the transfer can be stopped early. No DOM is built
+ * and nothing but the captured values is buffered.
+ *
+ * @example
+ * ```cpp
+ * ghupdate::ReleaseTagExtractor extractor;
+ * for (auto chunk : chunks) {
+ *     if (extractor.feed(chunk))
+ *         break;  // tag_name found
+ * }
+ * std::string tag = extractor.tag_or_throw();
+ * ```
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace ghupdate {
+
+/*!
+ * @class ReleaseTagExtractor
+ * @brief Incremental scanner for the top-level "tag_name" and "message" fields
+ *
+ * Only string values of keys of the top-level object are considered; keys
+ * with the same name inside nested objects or arrays (e.g. assets) and
+ * occurrences inside other strings (e.g. the release body) are ignored.
+ * JSON string escapes including \\uXXXX surrogate pairs are decoded.
+ */
+class ReleaseTagExtractor {
+public:
+    /*!
+     * @brief Feeds the next chunk of the response body
+     *
+     * @param chunk Next bytes of the body, in order
+     * @return true once tag_name has been found; further input is ignored
+     */
+    bool feed(std::string_view chunk) {
+        std::size_t i = 0;
+        while (i < chunk.size() && !done_) {
+            // Fast path: skip the content of strings that are not captured
+            if (inString_ && capture_ == Capture::None && !escape_ && unicodeLeft_ == 0) {
+                auto next = chunk.find_first_of("\"\\", i);
+                if (next == std::string_view::npos)
+                    return false;
+                i = next;
+            }
+            step(chunk[i++]);
+        }
+        return done_;
+    }
+
+    /*!
+     * @brief true once the top-level tag_name string has been extracted
+     */
+    bool done() const { return done_; }
+
+    /*!
+     * @brief Extracted tag_name, if found
+     */
+    const std::optional<std::string>& tag() const { return tag_; }
+
+    /*!
+     * @brief Extracted top-level message (GitHub API error text), if found
+     */
+    const std::optional<std::string>& message() const { return message_; }
+
+    /*!
+     * @brief Returns the tag or throws the error the API response describes
+     *
+     * @return Value of tag_name
+     * @throws std::runtime_error "GitHub API error: <message>" if the
+     *         response carried a message but no tag_name, or
+     *         "GitHub API returned no valid tag_name" otherwise
+     */
+    std::string tag_or_throw() const {
+        if (tag_)
+            return *tag_;
+        if (message_)
+            throw std::runtime_error("GitHub API error: " + *message_);
+        throw std::runtime_error("GitHub API returned no valid tag_name");
+    }
+
+private:
+    enum class Field : std::uint8_t { Other, Tag, Message };
+    enum class Capture : std::uint8_t { None, Key, Value };
+
+    void step(char c) {
+        if (inString_) {
+            string_char(c);
+            return;
+        }
+
+        switch (c) {
+        case ' ': case '\t': case '\n': case '\r':
+            return;
+        case '"':
+            inString_ = true;
+            buffer_.clear();
+            if (depth_ == 1 && expectKey_) {
+                capture_ = Capture::Key;
+                expectKey_ = false;
+            } else if (depth_ == 1 && awaitingValue_) {
+                capture_ = field_ == Field::Other ? Capture::None : Capture::Value;
+                awaitingValue_ = false;
+            }
+            return;
+        case '{':
+        case '[':
+            awaitingValue_ = false;
+            ++depth_;
+            expectKey_ = depth_ == 1 && c == '{';
+            return;
+        case '}':
+        case ']':
+            if (depth_ > 0)
+                --depth_;
+            return;
+        case ':':
+            if (depth_ == 1)
+                awaitingValue_ = true;
+            return;
+        case ',':
+            if (depth_ == 1) {
+                expectKey_ = true;
+                awaitingValue_ = false;
+            }
+            return;
+        default:
+            // Numbers, true/false/null: a non-string value for the pending key
+            if (depth_ == 1)
+                awaitingValue_ = false;
+            return;
+        }
+    }
+
+    void string_char(char c) {
+        if (unicodeLeft_ > 0) {
+            unicode_digit(c);
+            return;
+        }
+
+        if (escape_) {
+            escape_ = false;
+            switch (c) {
+            case 'b': append('\b'); break;
+            case 'f': append('\f'); break;
+            case 'n': append('\n'); break;
+            case 'r': append('\r'); break;
+            case 't': append('\t'); break;
+            case 'u': unicodeLeft_ = 4; codeUnit_ = 0; break;
+            default: append(c); break;  // '"', '\\', '/'
+            }
+            return;
+        }
+
+        if (c == '\\') {
+            escape_ = true;
+        } else if (c == '"') {
+            end_string();
+        } else {
+            append(c);
+        }
+    }
+
+    void unicode_digit(char c) {
+        std::uint32_t digit = 0;
+        if (c >= '0' && c <= '9') digit = static_cast<std::uint32_t>(c - '0');
+        else if (c >= 'a' && c <= 'f') digit = static_cast<std::uint32_t>(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') digit = static_cast<std::uint32_t>(c - 'A' + 10);
+        codeUnit_ = (codeUnit_ << 4) | digit;
+        if (--unicodeLeft_ > 0)
+            return;
+
+        if (codeUnit_ >= 0xD800 && codeUnit_ <= 0xDBFF) {
+            highSurrogate_ = codeUnit_;
+            return;
+        }
+        std::uint32_t cp = codeUnit_;
+        if (codeUnit_ >= 0xDC00 && codeUnit_ <= 0xDFFF && highSurrogate_) {
+            cp = 0x10000 + ((highSurrogate_ - 0xD800) << 10) + (codeUnit_ - 0xDC00);
+        }
+        highSurrogate_ = 0;
+        append_utf8(cp);
+    }
+
+    void append(char c) {
+        if (capture_ != Capture::None)
+            buffer_ += c;
+    }
+
+    void append_utf8(std::uint32_t cp) {
+        if (cp < 0x80) {
+            append(static_cast<char>(cp));
+        } else if (cp < 0x800) {
+            append(static_cast<char>(0xC0 | (cp >> 6)));
+            append(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else if (cp < 0x10000) {
+            append(static_cast<char>(0xE0 | (cp >> 12)));
+            append(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            append(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else {
+            append(static_cast<char>(0xF0 | (cp >> 18)));
+            append(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+            append(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            append(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+    }
+
+    void end_string() {
+        inString_ = false;
+        if (capture_ == Capture::Key) {
+            field_ = buffer_ == "tag_name" ? Field::Tag
+                   : buffer_ == "message"  ? Field::Message
+                                           : Field::Other;
+        } else if (capture_ == Capture::Value) {
+            if (field_ == Field::Tag) {
+                tag_ = std::move(buffer_);
+                done_ = true;
+            } else if (field_ == Field::Message) {
+                message_ = std::move(buffer_);
+            }
+        }
+        capture_ = Capture::None;
+        buffer_.clear();
+    }
+
+    std::optional<std::string> tag_;
+    std::optional<std::string> message_;
+    std::string buffer_;
+    std::uint32_t depth_ = 0;
+    std::uint32_t codeUnit_ = 0;
+    std::uint32_t highSurrogate_ = 0;
+    int unicodeLeft_ = 0;
+    Field field_ = Field::Other;
+    Capture capture_ = Capture::None;
+    bool inString_ = false;
+    bool escape_ = false;
+    bool expectKey_ = false;
+    bool awaitingValue_ = false;
+    bool done_ = false;
+};
+
+} // namespace ghupdate
@@ -0,0 +1,232 @@
+/*!
+ * @file update_cache.hpp
+ * @brief In-process LRU cache of latest releases for long-running hosts
+ *
+ * Applications that call check_github_update() repeatedly (e.g. each time a
+ * settings page opens) would otherwise hit the network and parse JSON on
+ * every call. UpdateCache keeps the latest release tag of recently checked
+ * repositories in memory, keyed by the canonical API URL from
+ * to_github_api_url():
+ *
+ *  - entries expire after a TTL and the least recently used entry is
+ *    evicted once the capacity is reached
+ *  - definitive failures (no such repository or release, no valid tag) are
+ *    cached too (negative caching), for a shorter TTL; transient ones such
+ *    as network errors, 5xx, rate limits, deadlines and cancellations are
+ *    only reported to the callers sharing that request
+ *  - concurrent callers asking for the same repository share one in-flight
+ *    request instead of each sending their own
+ *
+ * @example
+ * ```cpp
+ * static ghupdate::UpdateCache cache({.ttl = std::chrono::minutes(30)});
+ * auto result = cache.check("https://github.com/nlohmann/json", "3.11.2");
+ * ```
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <check_gh-update.hpp>
+#include <chrono>
+#include <functional>
+#include <list>
+#include <unordered_map>
+
+namespace ghupdate {
+
+/*!
+ * @struct UpdateCacheOptions
+ * @brief Tuning parameters for UpdateCache
+ */
+struct UpdateCacheOptions {
+    std::size_t capacity = 256;                                    ///< Maximum number of cached repositories
+    std::chrono::steady_clock::duration ttl = std::chrono::minutes(10);       ///< Lifetime of successful lookups
+    std::chrono::steady_clock::duration errorTtl = std::chrono::seconds(30);  ///< Lifetime of failed lookups
+};
+
+/*!
+ * @class UpdateCache
+ * @brief Thread-safe LRU cache with TTL, negative caching and request coalescing
+ */
+class UpdateCache {
+public:
+    /*!
+     * @brief Fetches the latest release tag for a canonical API URL
+     *
+     * Must throw on failure. The message of an ApiError that is
+     * definitive() is cached as the error; any other exception only fails
+     * the lookups waiting for this fetch.
+     */
+    using Fetcher = std::function<std::string(const std::string& apiUrl)>;
+
+    /*!
+     * @brief Creates a cache that fetches through a Client per lookup
+     *
+     * All clients share one SharedCache, so connections and TLS sessions
+     * are reused between lookups.
+     *
+     * @param options Capacity and TTLs
+     * @param check Options applied to every network lookup
+     */
+    explicit UpdateCache(UpdateCacheOptions options = {}, CheckOptions check = {})
+        : options_(options) {
+        auto shared = std::make_shared<SharedCache>();
+        fetcher_ = [shared, check](const std::string& apiUrl) {
+            Client client(shared);
+            return client.latest_release(apiUrl, check).latestVersion;
+        };
+    }
+
+    /*!
+     * @brief Creates a cache with a custom fetch function
+     *
+     * @param options Capacity and TTLs
+     * @param fetcher Function resolving an API URL to its latest release tag
+     */
+    UpdateCache(UpdateCacheOptions options, Fetcher fetcher)
+        : options_(options), fetcher_(std::move(fetcher)) {}
+
+    UpdateCache(const UpdateCache&) = delete;
+    UpdateCache& operator=(const UpdateCache&) = delete;
+
+    /*!
+     * @brief Checks for updates, answering from the cache when possible
+     *
+     * @param repoUrl GitHub repository URL or API URL
+     * @param localVersion Local version string (will be parsed as SemVer)
+     * @return UpdateInfo with the comparison result
+     * @throws std::runtime_error on the same conditions as check_github_update();
+     *         cached failures are rethrown with their original message
+     */
+    UpdateInfo check(std::string_view repoUrl, std::string_view localVersion) {
+        Value value = lookup(to_github_api_url(repoUrl));
+        if (!value.error.empty())
+            throw std::runtime_error(value.error);
+
+        SemVer local = SemVer::parse(localVersion);
+        SemVer remote = SemVer::parse(value.latestVersion);
+        return {remote > local, value.latestVersion};
+    }
+
+    /*!
+     * @brief Drops a single repository from the cache
+     * @param repoUrl GitHub repository URL or API URL
+     */
+    void invalidate(std::string_view repoUrl) {
+        std::string key = to_github_api_url(repoUrl);
+        std::lock_guard lock(mutex_);
+        if (auto it = index_.find(key); it != index_.end()) {
+            lru_.erase(it->second);
+            index_.erase(it);
+        }
+    }
+
+    /*!
+     * @brief Drops all cached entries
+     */
+    void clear() {
+        std::lock_guard lock(mutex_);
+        lru_.clear();
+        index_.clear();
+    }
+
+    /*!
+     * @brief Number of cached entries (including expired ones not yet evicted)
+     */
+    std::size_t size() const {
+        std::lock_guard lock(mutex_);
+        return index_.size();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Value {
+        std::string latestVersion;  ///< Release tag on success
+        std::string error;          ///< Error message on failure
+        bool cacheable = true;      ///< false for transient failures
+    };
+
+    struct Node {
+        std::string key;
+        Value value;
+        Clock::time_point expires;
+    };
+
+    Value lookup(const std::string& key) {
+        std::unique_lock lock(mutex_);
+
+        if (auto it = index_.find(key); it != index_.end()) {
+            if (Clock::now() < it->second->expires) {
+                lru_.splice(lru_.begin(), lru_, it->second);
+                return it->second->value;
+            }
+            lru_.erase(it->second);
+            index_.erase(it);
+        }
+
+        if (auto it = inflight_.find(key); it != inflight_.end()) {
+            auto shared = it->second;
+            lock.unlock();
+            return shared.get();
+        }
+
+        std::promise<Value> promise;
+        inflight_.emplace(key, promise.get_future().share());
+        lock.unlock();
+
+        Value value;
+        try {
+            value.latestVersion = fetcher_(key);
+        } catch (const ApiError& e) {
+            value.error = e.what();
+            value.cacheable = e.definitive();
+        } catch (const std::exception& e) {
+            value.error = e.what();
+            value.cacheable = false;
+        } catch (...) {
+            // Still publish a result, or waiters and later lookups of the key would fail forever
+            value.error = "Update check failed: unknown error";
+            value.cacheable = false;
+        }
+
+        lock.lock();
+        if (value.cacheable)
+            insert(key, value);
+        inflight_.erase(key);
+        lock.unlock();
+
+        promise.set_value(value);
+        return value;
+    }
+
+    void insert(const std::string& key, const Value& value) {
+        if (options_.capacity == 0)
+            return;
+
+        if (auto it = index_.find(key); it != index_.end())
+            lru_.erase(it->second);
+
+        auto ttl = value.error.empty() ? options_.ttl : options_.errorTtl;
+        lru_.push_front(Node{key, value, Clock::now() + ttl});
+        index_[key] = lru_.begin();
+
+        while (index_.size() > options_.capacity) {
+            index_.erase(lru_.back().key);
+            lru_.pop_back();
+        }
+    }
+
+    UpdateCacheOptions options_;
+    Fetcher fetcher_;
+    mutable std::mutex mutex_;
+    std::list<Node> lru_;
+    std::unordered_map<std::string, std::list<Node>::iterator> index_;
+    std::unordered_map<std::string, std::shared_future<Value>> inflight_;
+};
+
+} // namespace ghupdate
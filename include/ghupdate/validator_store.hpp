@@ -0,0 +1,196 @@
+/*!
+ * @file validator_store.hpp
+ * @brief Persistent store of HTTP cache validators for conditional requests
+ *
+ * GitHub answers a request carrying `If-None-Match` (or `If-Modified-Since`)
+ * with `304 Not Modified` when the release has not changed. Such responses
+ * have no body and do not count against the API rate limit. ValidatorStore
+ * remembers the `ETag` / `Last-Modified` of each `/releases/latest` URL
+ * together with the release tag it described, and can persist them to a
+ * JSON file so the validators survive restarts.
+ *
+ * @example
+ * ```cpp
+ * ghupdate::ValidatorStore store("/var/cache/gh-update-checker/etags.json");
+ * auto result = ghupdate::check_github_update(url, "3.11.2", {.validators = &store});
+ * store.save();
+ * ```
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+
+namespace ghupdate {
+
+/*!
+ * @class ValidatorStore
+ * @brief Thread-safe map from API URL to cache validators and release tag
+ *
+ * A default-constructed store lives in memory only. A store constructed with
+ * a file path loads it (if present) and writes all entries back on save()
+ * or, if modified, on destruction. Files are replaced atomically, so a
+ * crash while saving never leaves a truncated store behind.
+ */
+class ValidatorStore {
+public:
+    /*!
+     * @struct Entry
+     * @brief Validators and release tag recorded for one URL
+     */
+    struct Entry {
+        std::string etag;           ///< Value of the ETag response header
+        std::string lastModified;   ///< Value of the Last-Modified response header
+        std::string latestVersion;  ///< tag_name of the release the validators belong to
+    };
+
+    ValidatorStore() = default;
+
+    /*!
+     * @brief Creates a store backed by a JSON file
+     *
+     * @param file Path of the store; loaded immediately if it exists
+     * @throws std::runtime_error if the file exists but cannot be parsed
+     */
+    explicit ValidatorStore(std::filesystem::path file) : file_(std::move(file)) {
+        load();
+    }
+
+    ~ValidatorStore() {
+        if (dirty_ && !file_.empty()) {
+            try {
+                save();
+            } catch (...) {
+                // Losing validators only costs one unconditional request later
+            }
+        }
+    }
+
+    ValidatorStore(const ValidatorStore&) = delete;
+    ValidatorStore& operator=(const ValidatorStore&) = delete;
+
+    /*!
+     * @brief Looks up the validators recorded for a URL
+     * @param url Canonical API URL
+     * @return Stored entry, or std::nullopt if none is known
+     */
+    std::optional<Entry> find(std::string_view url) const {
+        std::shared_lock lock(mutex_);
+        auto it = entries_.find(std::string(url));
+        if (it == entries_.end())
+            return std::nullopt;
+        return it->second;
+    }
+
+    /*!
+     * @brief Records validators for a URL, replacing any previous entry
+     * @param url Canonical API URL
+     * @param entry Validators and release tag to store
+     */
+    void store(std::string url, Entry entry) {
+        std::unique_lock lock(mutex_);
+        entries_.insert_or_assign(std::move(url), std::move(entry));
+        dirty_ = true;
+    }
+
+    /*!
+     * @brief Number of stored entries
+     */
+    std::size_t size() const {
+        std::shared_lock lock(mutex_);
+        return entries_.size();
+    }
+
+    /*!
+     * @brief Writes all entries to the backing file
+     *
+     * Does nothing for in-memory stores.
+     *
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void save() {
+        if (file_.empty())
+            return;
+
+        nlohmann::json json = nlohmann::json::object();
+        {
+            std::shared_lock lock(mutex_);
+            // Cleared under the lock, so a store() racing with the write
+            // below marks the store dirty again instead of being dropped
+            dirty_.exchange(false);
+            for (const auto& [url, entry] : entries_) {
+                json[url] = {
+                    {"etag", entry.etag},
+                    {"last_modified", entry.lastModified},
+                    {"tag_name", entry.latestVersion},
+                };
+            }
+        }
+
+        if (file_.has_parent_path())
+            std::filesystem::create_directories(file_.parent_path());
+
+        // Unique per writer, so concurrent saves never share a temporary file
+        auto tmp = file_;
+        tmp += ".tmp" + std::to_string(std::random_device{}());
+        try {
+            std::ofstream out(tmp, std::ios::trunc);
+            if (!out)
+                throw std::runtime_error("Cannot write validator store: " + tmp.string());
+            out << json.dump();
+            out.close();
+            if (!out)
+                throw std::runtime_error("Cannot write validator store: " + tmp.string());
+            std::filesystem::rename(tmp, file_);
+        } catch (...) {
+            std::error_code ignored;
+            std::filesystem::remove(tmp, ignored);
+            dirty_ = true;
+            throw;
+        }
+    }
+
+private:
+    void load() {
+        std::ifstream in(file_);
+        if (!in)
+            return;
+
+        nlohmann::json json = nlohmann::json::parse(in, nullptr, false);
+        if (json.is_discarded() || !json.is_object())
+            throw std::runtime_error("Invalid validator store: " + file_.string());
+
+        for (const auto& [url, value] : json.items()) {
+            if (!value.is_object())
+                continue;
+            entries_.emplace(url, Entry{
+                value.value("etag", ""),
+                value.value("last_modified", ""),
+                value.value("tag_name", ""),
+            });
+        }
+    }
+
+    std::filesystem::path file_;
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::atomic<bool> dirty_{false};
+};
+
+} // namespace ghupdate
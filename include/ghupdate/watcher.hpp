@@ -0,0 +1,223 @@
+/*!
+ * @file watcher.hpp
+ * @brief Long-running periodic re-checks of a set of repositories
+ *
+ * Re-running the CLI from cron for every repository costs a process launch,
+ * a TLS handshake and a full release download per check. Watcher keeps all
+ * repositories resident instead: each has its own check interval, due
+ * checks are taken from a min-heap ordered by due time, and a fixed set of
+ * workers performs them over persistent connections (one Client each, all
+ * sharing one SharedCache) with a ValidatorStore, so an unchanged release
+ * costs a single 304 response.
+ *
+ * Only changes are reported: the callback fires for the first result of a
+ * repository and whenever UpdateInfo::hasUpdate or UpdateInfo::latestVersion
+ * differ from the last reported result. A failing check is reported once
+ * per distinct error message; the repository keeps its last good result.
+ *
+ * @example
+ * ```cpp
+ * ghupdate::Watcher watcher;
+ * watcher.add({"https://github.com/nlohmann/json", "3.11.2"}, std::chrono::minutes(5));
+ * watcher.add({"https://github.com/curl/curl", "8.7.0"}, std::chrono::hours(1));
+ *
+ * std::jthread thread([&](std::stop_token stop) {
+ *     watcher.run(stop, [](const ghupdate::WatchEvent& event) {
+ *         if (event.result && event.result->hasUpdate)
+ *             std::println("{}: {}", event.repo.repoUrl, event.result->latestVersion);
+ *     });
+ * });
+ * ```
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <check_gh-update.hpp>
+#include <deque>
+#include <queue>
+
+namespace ghupdate {
+
+/*!
+ * @struct WatchOptions
+ * @brief Tuning parameters for Watcher
+ */
+struct WatchOptions {
+    std::size_t concurrency = 4;  ///< Checks running at once (0 is treated as 1)
+
+    /*!
+     * Options applied to every check. Without CheckOptions::validators the
+     * watcher keeps its own in-memory ValidatorStore; CheckOptions::stopToken
+     * is replaced by the token passed to Watcher::run().
+     */
+    CheckOptions check{};
+};
+
+/*!
+ * @struct WatchEvent
+ * @brief Changed result of a watched repository
+ */
+struct WatchEvent {
+    std::size_t id;                                ///< Value returned by Watcher::add()
+    const RepoCheck& repo;                         ///< Watched repository and local version
+    const CheckResult& result;                     ///< New result, or the new error
+    std::chrono::steady_clock::duration elapsed;  ///< Duration of the check
+};
+
+/*!
+ * @class Watcher
+ * @brief Heap-scheduled periodic update checks that report only changes
+ *
+ * Repositories may be added before or while run() is active. The watcher
+ * must outlive run().
+ */
+class Watcher {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Callback = std::function<void(const WatchEvent&)>;
+
+    explicit Watcher(WatchOptions options = {}) : options_(std::move(options)) {
+        if (!options_.check.validators)
+            options_.check.validators = &validators_;
+    }
+
+    Watcher(const Watcher&) = delete;
+    Watcher& operator=(const Watcher&) = delete;
+
+    /*!
+     * @brief Adds a repository; its first check is due immediately
+     *
+     * @param repo Repository URL and local version
+     * @param interval Time between the end of one check and the start of the next
+     * @return Id of the repository, reported in its WatchEvents
+     */
+    std::size_t add(RepoCheck repo, std::chrono::seconds interval) {
+        std::lock_guard lock(mutex_);
+        const std::size_t id = entries_.size();
+        entries_.push_back({id, std::move(repo), std::max(interval, std::chrono::seconds(1))});
+        due_.push({Clock::now(), id});
+        cv_.notify_one();
+        return id;
+    }
+
+    /*!
+     * @brief Number of watched repositories
+     */
+    std::size_t size() const {
+        std::lock_guard lock(mutex_);
+        return entries_.size();
+    }
+
+    /*!
+     * @brief Performs due checks until stop is requested
+     *
+     * @param stop Ends the watch; running checks are cancelled
+     * @param onEvent Called for every changed result; calls are serialized
+     *        and exceptions escaping it are swallowed
+     */
+    void run(std::stop_token stop, Callback onEvent) {
+        CheckOptions check = options_.check;
+        check.stopToken = stop;
+
+        auto shared = std::make_shared<SharedCache>();
+        std::mutex eventMutex;
+        auto worker = [&](std::stop_token) {
+            Client client(shared);
+            while (Entry* due = next_due(stop)) {
+                Entry& entry = *due;
+
+                const auto started = Clock::now();
+                CheckResult result;
+                try {
+                    result = client.check(entry.repo.repoUrl, entry.repo.localVersion, check);
+                } catch (const std::exception& e) {
+                    result = std::unexpected(std::string(e.what()));
+                }
+                const auto elapsed = Clock::now() - started;
+                if (stop.stop_requested())
+                    return;
+
+                if (changed(entry, result) && onEvent) {
+                    std::lock_guard lock(eventMutex);
+                    try {
+                        onEvent({entry.id, entry.repo, result, elapsed});
+                    } catch (...) {
+                        // A failing consumer must not stop the watch
+                    }
+                }
+
+                std::lock_guard lock(mutex_);
+                due_.push({Clock::now() + entry.interval, entry.id});
+                cv_.notify_one();
+            }
+        };
+
+        // Each worker is joined (and its Client released) before run() returns
+        std::vector<std::jthread> workers;
+        const std::size_t count = std::max<std::size_t>(options_.concurrency, 1);
+        for (std::size_t i = 1; i < count; ++i)
+            workers.emplace_back(worker);
+        worker(stop);
+    }
+
+private:
+    struct Entry {
+        std::size_t id;
+        RepoCheck repo;
+        std::chrono::seconds interval;
+        std::optional<UpdateInfo> last{};  // last reported result
+        std::string lastError{};           // error reported since then
+    };
+
+    using Due = std::pair<Clock::time_point, std::size_t>;
+
+    // Pops the next repository once it is due; nullptr when stopped.
+    // Entries live in a deque, so the pointer stays valid while add() appends.
+    Entry* next_due(std::stop_token stop) {
+        std::unique_lock lock(mutex_);
+        while (!stop.stop_requested()) {
+            if (due_.empty()) {
+                cv_.wait(lock, stop, [this] { return !due_.empty(); });
+                continue;
+            }
+            const Due top = due_.top();
+            if (top.first <= Clock::now()) {
+                due_.pop();
+                return &entries_[top.second];
+            }
+            // Woken early by add() or a re-queued entry that may be due sooner
+            cv_.wait_until(lock, stop, top.first, [&] { return due_.empty() || due_.top() != top; });
+        }
+        return nullptr;
+    }
+
+    // Records the result and returns whether it has to be reported.
+    // Only the worker holding the entry touches last/lastError.
+    static bool changed(Entry& entry, const CheckResult& result) {
+        if (!result) {
+            if (result.error() == entry.lastError)
+                return false;
+            entry.lastError = result.error();
+            return true;
+        }
+        entry.lastError.clear();
+        if (entry.last && entry.last->hasUpdate == result->hasUpdate &&
+            entry.last->latestVersion == result->latestVersion)
+            return false;
+        entry.last = *result;
+        return true;
+    }
+
+    WatchOptions options_;
+    ValidatorStore validators_;
+    mutable std::mutex mutex_;
+    std::condition_variable_any cv_;
+    std::deque<Entry> entries_;
+    std::priority_queue<Due, std::vector<Due>, std::greater<>> due_;
+};
+
+} // namespace ghupdate
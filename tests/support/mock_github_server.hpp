@@ -0,0 +1,462 @@
+/*!
+ * @file mock_github_server.hpp
+ * @brief In-process mock of the GitHub /releases/latest REST endpoint
+ *
+ * Serves generated release documents (see release_fixtures.hpp) over
+ * plain HTTP/1.1 on the loopback interface, so end-to-end checks and load
+ * benchmarks run without network access and without spending API quota.
+ * Like the real API it answers conditional requests with 304 Not Modified,
+ * sends X-RateLimit-* headers and keeps connections alive; on top of that
+ * it can add latency and inject errors.
+ *
+ * POST /graphql answers the aliased `repository(owner:, name:)` queries of
+ * graphql::build_query() from the same releases, so batch checks through
+ * check_github_updates_graphql() can be tested end to end as well.
+ *
+ * The checker passes any URL containing "api.github.com" through
+ * unchanged, so api_url() mounts the API below
+ * http://127.0.0.1:PORT/api.github.com/.
+ *
+ * @example
+ * ```cpp
+ * ghupdate::fixtures::MockGitHubServer server({.latency = std::chrono::milliseconds(20)});
+ * server.set_release("nlohmann/json", "v3.11.3");
+ * auto info = ghupdate::check_github_update(server.api_url("nlohmann/json"), "3.11.2");
+ * ```
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <release_fixtures.hpp>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <shared_mutex>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+namespace ghupdate::fixtures {
+
+/*!
+ * @struct MockOptions
+ * @brief Behaviour of a MockGitHubServer
+ */
+struct MockOptions {
+    std::uint16_t port = 0;                      ///< TCP port on 127.0.0.1 (0 picks a free one)
+    std::chrono::microseconds latency{0};        ///< Delay before every response
+    std::chrono::microseconds jitter{0};         ///< Extra uniformly distributed delay in [0, jitter]
+    bool etags = true;                           ///< Send ETags and answer If-None-Match with 304
+    long long rateLimit = 1'000'000;             ///< Requests per window before 403 rate limit errors
+    std::chrono::seconds rateLimitWindow{3600};  ///< Length of a rate limit window
+    std::size_t errorEvery = 0;                  ///< Answer every n-th request with errorStatus (0 = never)
+    int errorStatus = 503;                       ///< Status of injected errors
+    std::string defaultTag{};                    ///< Tag served for unknown repositories (404 if empty)
+    std::string token{};                         ///< Token /graphql requires as "bearer <token>" (empty = any)
+};
+
+/*!
+ * @struct MockStats
+ * @brief Counters of a MockGitHubServer
+ */
+struct MockStats {
+    std::uint64_t requests = 0;     ///< Requests answered
+    std::uint64_t notModified = 0;  ///< 304 answers
+    std::uint64_t errors = 0;       ///< Injected errors, 404s and rate limit errors
+    std::uint64_t connections = 0;  ///< Accepted connections
+};
+
+/*!
+ * @class MockGitHubServer
+ * @brief Loopback HTTP server emulating GET /repos/{owner}/{repo}/releases/latest and POST /graphql
+ *
+ * Serving starts in the constructor and stops in the destructor. Each
+ * connection is handled by its own thread, so concurrent clients never
+ * queue behind the configured latency of another request.
+ */
+class MockGitHubServer {
+public:
+    /*!
+     * @brief Binds to 127.0.0.1 and starts serving
+     *
+     * @throws std::runtime_error if the port cannot be bound
+     */
+    explicit MockGitHubServer(MockOptions options = {}) : options_(std::move(options)) {
+        listen_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (listen_ < 0)
+            throw std::runtime_error(std::string("Cannot create mock server socket: ") + std::strerror(errno));
+        int on = 1;
+        setsockopt(listen_, SOL_SOCKET, SO_REUSEADDR, &on, sizeof on);
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(options_.port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (::bind(listen_, reinterpret_cast<sockaddr*>(&address), sizeof address) != 0 ||
+            ::listen(listen_, 128) != 0) {
+            const int error = errno;
+            ::close(listen_);
+            throw std::runtime_error("Cannot listen on 127.0.0.1:" + std::to_string(options_.port) + ": " +
+                                     std::strerror(error));
+        }
+        socklen_t length = sizeof address;
+        getsockname(listen_, reinterpret_cast<sockaddr*>(&address), &length);
+        port_ = ntohs(address.sin_port);
+
+        windowEnd_ = std::chrono::system_clock::now() + options_.rateLimitWindow;
+        remaining_ = options_.rateLimit;
+        acceptor_ = std::jthread([this](std::stop_token stop) { accept_loop(stop); });
+    }
+
+    ~MockGitHubServer() {
+        acceptor_.request_stop();
+        acceptor_.join();
+        ::close(listen_);
+    }
+
+    MockGitHubServer(const MockGitHubServer&) = delete;
+    MockGitHubServer& operator=(const MockGitHubServer&) = delete;
+
+    /*!
+     * @brief Serves a generated release document for a repository
+     *
+     * @param slug Repository as "owner/repo"
+     * @param tag Value of tag_name
+     * @param shape Size of the document
+     */
+    void set_release(std::string_view slug, std::string_view tag, ReleaseShape shape = kMediumRelease) {
+        Release release{release_json(slug, tag, shape), {}, std::string(tag)};
+        release.etag = "\"" + std::to_string(std::hash<std::string>{}(release.body)) + "\"";
+        std::unique_lock lock(mutex_);
+        releases_.insert_or_assign(std::string(slug), std::move(release));
+    }
+
+    /*!
+     * @brief URL of the /releases/latest endpoint of @p slug on this server
+     */
+    std::string api_url(std::string_view slug) const {
+        return "http://127.0.0.1:" + std::to_string(port_) + "/api.github.com/repos/" + std::string(slug) +
+               "/releases/latest";
+    }
+
+    /*!
+     * @brief URL of the GraphQL endpoint on this server, for GraphQLOptions::endpoint
+     */
+    std::string graphql_url() const {
+        return "http://127.0.0.1:" + std::to_string(port_) + "/api.github.com/graphql";
+    }
+
+    std::uint16_t port() const { return port_; }
+
+    MockStats stats() const {
+        return {requests_.load(), notModified_.load(), errors_.load(), connections_.load()};
+    }
+
+private:
+    struct Release {
+        std::string body;
+        std::string etag;
+        std::string tag;
+    };
+
+    struct Connection {
+        std::jthread thread;
+        std::atomic<bool> done{false};
+    };
+
+    void accept_loop(std::stop_token stop) {
+        // Only this thread touches the list; finished connections are joined on the way
+        std::list<Connection> connections;
+        pollfd pfd{listen_, POLLIN, 0};
+        while (!stop.stop_requested()) {
+            std::erase_if(connections, [](const Connection& c) { return c.done.load(); });
+            if (::poll(&pfd, 1, 50) <= 0)
+                continue;
+            int client = ::accept(listen_, nullptr, nullptr);
+            if (client < 0)
+                continue;
+            connections_.fetch_add(1);
+            Connection& connection = connections.emplace_back();
+            connection.thread = std::jthread([this, client, &connection, stop](std::stop_token) {
+                serve(client, stop);
+                ::close(client);
+                connection.done = true;
+            });
+        }
+    }
+
+    // Answers requests on one keep-alive connection until the client closes it
+    void serve(int client, const std::stop_token& stop) {
+        int on = 1;
+        setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &on, sizeof on);
+
+        std::string buffer;
+        char chunk[4096];
+        pollfd pfd{client, POLLIN, 0};
+        while (!stop.stop_requested()) {
+            const std::size_t end = buffer.find("\r\n\r\n");
+            const std::size_t length =
+                end == std::string::npos
+                    ? 0
+                    : std::strtoull(header(std::string_view(buffer).substr(0, end + 4), "content-length").c_str(),
+                                    nullptr, 10);
+            if (end == std::string::npos || buffer.size() < end + 4 + length) {
+                if (::poll(&pfd, 1, 50) <= 0)
+                    continue;
+                ssize_t n = ::recv(client, chunk, sizeof chunk, 0);
+                if (n <= 0)
+                    return;
+                buffer.append(chunk, static_cast<std::size_t>(n));
+                continue;
+            }
+
+            const std::string request = buffer.substr(0, end + 4);
+            const std::string body = buffer.substr(end + 4, length);
+            buffer.erase(0, end + 4 + length);
+            bool keepAlive = true;
+            std::string response = respond(request, body, keepAlive, stop);
+            if (!send_all(client, response) || !keepAlive)
+                return;
+        }
+    }
+
+    std::string respond(std::string_view request, std::string_view body, bool& keepAlive,
+                        const std::stop_token& stop) {
+        std::string_view line = request.substr(0, request.find("\r\n"));
+        std::string_view target = line.substr(std::min(line.size(), line.find(' ') + 1));
+        target = target.substr(0, target.find(' '));
+        const std::string ifNoneMatch = header(request, "if-none-match");
+        keepAlive = header(request, "connection") != "close";
+
+        delay(stop);
+        const std::uint64_t number = requests_.fetch_add(1) + 1;
+
+        if (options_.errorEvery && number % options_.errorEvery == 0) {
+            errors_.fetch_add(1);
+            return response(options_.errorStatus, "Injected Error",
+                            R"({"message":"Injected error"})", {}, rate_limit_headers(false), keepAlive);
+        }
+
+        if (line.starts_with("POST ") && target.ends_with("/graphql"))
+            return graphql(request, body, keepAlive);
+
+        // /.../repos/{owner}/{repo}/releases/latest
+        constexpr std::string_view suffix = "/releases/latest";
+        const std::size_t repos = target.find("/repos/");
+        if (repos == std::string_view::npos || !target.ends_with(suffix)) {
+            errors_.fetch_add(1);
+            return response(404, "Not Found", R"({"message":"Not Found"})", {}, rate_limit_headers(false),
+                            keepAlive);
+        }
+        const std::optional<Release> release =
+            find_release(std::string(target.substr(repos + 7, target.size() - repos - 7 - suffix.size())));
+        if (!release) {
+            errors_.fetch_add(1);
+            return response(404, "Not Found", R"({"message":"Not Found"})", {}, rate_limit_headers(false),
+                            keepAlive);
+        }
+        // Like GitHub, a 304 does not count against the rate limit
+        if (options_.etags && !ifNoneMatch.empty() && ifNoneMatch == release->etag) {
+            notModified_.fetch_add(1);
+            return response(304, "Not Modified", {}, release->etag, rate_limit_headers(false), keepAlive);
+        }
+
+        std::string limits = rate_limit_headers(true);
+        if (limits.empty()) {
+            errors_.fetch_add(1);
+            return response(403, "Forbidden", R"({"message":"API rate limit exceeded for 127.0.0.1."})", {},
+                            rate_limit_headers(false), keepAlive);
+        }
+        return response(200, "OK", release->body, options_.etags ? release->etag : std::string(), limits,
+                        keepAlive);
+    }
+
+    // POST /graphql with a query built by graphql::build_query(); other queries resolve nothing
+    std::string graphql(std::string_view request, std::string_view body, bool keepAlive) {
+        const std::string authorization = header(request, "authorization");
+        if (authorization.empty() || (!options_.token.empty() && authorization != "bearer " + options_.token)) {
+            errors_.fetch_add(1);
+            return response(401, "Unauthorized",
+                            authorization.empty() ? R"({"message":"This endpoint requires you to be authenticated."})"
+                                                  : R"({"message":"Bad credentials"})",
+                            {}, {}, keepAlive);
+        }
+
+        // Fields look like r0:repository(owner:\"a\",name:\"b\") inside the JSON-encoded query
+        constexpr std::string_view field = R"(:repository(owner:\")";
+        constexpr std::string_view quote = R"(\")";
+        constexpr std::string_view separator = R"(\",name:\")";
+        std::string data;
+        std::string errors;
+        for (std::size_t pos = body.find(field); pos != std::string_view::npos; pos = body.find(field, pos + 1)) {
+            std::size_t start = pos;
+            while (start > 0 && std::isdigit(static_cast<unsigned char>(body[start - 1])))
+                --start;
+            const std::size_t owner = pos + field.size();
+            const std::size_t ownerEnd = body.find(separator, owner);
+            if (start == 0 || ownerEnd == std::string_view::npos)
+                continue;
+            const std::string alias(body.substr(start - 1, pos - start + 1));
+            const std::size_t name = ownerEnd + separator.size();
+            const std::string slug = std::string(body.substr(owner, ownerEnd - owner)) + '/' +
+                                     std::string(body.substr(name, body.find(quote, name) - name));
+
+            if (!data.empty())
+                data += ',';
+            if (const std::optional<Release> release = find_release(slug)) {
+                data += '"' + alias + R"(":{"latestRelease":{"tagName":")" + release->tag + "\"}}";
+            } else {
+                data += '"' + alias + "\":null";
+                errors += std::string(errors.empty() ? "" : ",") + R"({"type":"NOT_FOUND","path":[")" + alias +
+                          R"("],"message":"Could not resolve to a Repository with the name ')" + slug + "'.\"}";
+            }
+        }
+
+        std::string limits = rate_limit_headers(true);
+        if (limits.empty()) {
+            errors_.fetch_add(1);
+            return response(403, "Forbidden", R"({"message":"API rate limit exceeded for 127.0.0.1."})", {},
+                            rate_limit_headers(false), keepAlive);
+        }
+        std::string json = "{\"data\":{" + data + '}';
+        if (!errors.empty())
+            json += ",\"errors\":[" + errors + ']';
+        return response(200, "OK", json + '}', {}, limits, keepAlive);
+    }
+
+    // Release of "owner/repo", creating it from defaultTag if configured
+    std::optional<Release> find_release(const std::string& slug) {
+        {
+            std::shared_lock lock(mutex_);
+            if (auto it = releases_.find(slug); it != releases_.end())
+                return it->second;
+        }
+        if (options_.defaultTag.empty())
+            return std::nullopt;
+        set_release(slug, options_.defaultTag);
+        std::shared_lock lock(mutex_);
+        return releases_.at(slug);
+    }
+
+    // X-RateLimit-* headers; consumes one request if @p consume, returns "" if none is left
+    std::string rate_limit_headers(bool consume) {
+        std::lock_guard lock(rateMutex_);
+        const auto now = std::chrono::system_clock::now();
+        if (now >= windowEnd_) {
+            windowEnd_ = now + options_.rateLimitWindow;
+            remaining_ = options_.rateLimit;
+        }
+        if (consume) {
+            if (remaining_ == 0)
+                return {};
+            --remaining_;
+        }
+        const auto reset = std::chrono::duration_cast<std::chrono::seconds>(windowEnd_.time_since_epoch()).count();
+        return "X-RateLimit-Limit: " + std::to_string(options_.rateLimit) +
+               "\r\nX-RateLimit-Remaining: " + std::to_string(remaining_) +
+               "\r\nX-RateLimit-Used: " + std::to_string(options_.rateLimit - remaining_) +
+               "\r\nX-RateLimit-Reset: " + std::to_string(reset) + "\r\nX-RateLimit-Resource: core\r\n";
+    }
+
+    void delay(const std::stop_token& stop) const {
+        auto wait = options_.latency;
+        if (options_.jitter.count() > 0) {
+            thread_local std::minstd_rand random{std::random_device{}()};
+            wait += std::chrono::microseconds(
+                std::uniform_int_distribution<std::int64_t>(0, options_.jitter.count())(random));
+        }
+        // In slices, so that stopping the server is not held up by a long latency
+        const auto until = std::chrono::steady_clock::now() + wait;
+        for (auto now = std::chrono::steady_clock::now(); now < until && !stop.stop_requested();
+             now = std::chrono::steady_clock::now())
+            std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(until - now,
+                                                                                     std::chrono::milliseconds(50)));
+    }
+
+    static std::string response(int status, std::string_view reason, std::string_view body, std::string_view etag,
+                                std::string_view extraHeaders, bool keepAlive) {
+        std::string out = "HTTP/1.1 " + std::to_string(status) + " " + std::string(reason) + "\r\n";
+        if (status != 304)
+            out += "Content-Type: application/json; charset=utf-8\r\n";
+        out += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+        if (!etag.empty())
+            out += "ETag: " + std::string(etag) + "\r\n";
+        out += extraHeaders;
+        out += keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n";
+        out += body;
+        return out;
+    }
+
+    // Value of a request header (name in lower case), "" if absent
+    static std::string header(std::string_view request, std::string_view name) {
+        for (std::size_t pos = request.find("\r\n"); pos != std::string_view::npos;) {
+            const std::size_t start = pos + 2;
+            pos = request.find("\r\n", start);
+            std::string_view line = request.substr(start, pos == std::string_view::npos ? pos : pos - start);
+            if (line.size() <= name.size() || line[name.size()] != ':')
+                continue;
+            bool match = true;
+            for (std::size_t i = 0; i < name.size() && match; ++i)
+                match = std::tolower(static_cast<unsigned char>(line[i])) == name[i];
+            if (!match)
+                continue;
+            line.remove_prefix(name.size() + 1);
+            while (!line.empty() && line.front() == ' ')
+                line.remove_prefix(1);
+            return std::string(line);
+        }
+        return {};
+    }
+
+    static bool send_all(int client, std::string_view data) {
+        while (!data.empty()) {
+            ssize_t n = ::send(client, data.data(), data.size(), MSG_NOSIGNAL);
+            if (n <= 0)
+                return false;
+            data.remove_prefix(static_cast<std::size_t>(n));
+        }
+        return true;
+    }
+
+    MockOptions options_;
+    int listen_ = -1;
+    std::uint16_t port_ = 0;
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, Release> releases_;
+
+    std::mutex rateMutex_;
+    std::chrono::system_clock::time_point windowEnd_;
+    long long remaining_ = 0;
+
+    std::atomic<std::uint64_t> requests_{0};
+    std::atomic<std::uint64_t> notModified_{0};
+    std::atomic<std::uint64_t> errors_{0};
+    std::atomic<std::uint64_t> connections_{0};
+
+    std::jthread acceptor_;  // last: stopped and joined before the members above go away
+};
+
+} // namespace ghupdate::fixtures
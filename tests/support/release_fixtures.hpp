@@ -0,0 +1,104 @@
+/*!
+ * @file release_fixtures.hpp
+ * @brief GitHub-shaped /releases/latest response bodies for tests and benchmarks
+ *
+ * The documents follow the field order and nesting of real GitHub REST API
+ * responses (author object and node_id before tag_name, then the assets
+ * array and the release notes), so parsers see the same structure they meet
+ * in production without recording live responses into the repository.
+ * Size is controlled by the number of assets and the length of the body.
+ *
+ * SPDX-FileType: SOURCE
+ * SPDX-FileContributor: ZHENG Robert
+ * SPDX-FileCopyrightText: 2026 ZHENG Robert
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace ghupdate::fixtures {
+
+/*!
+ * @struct ReleaseShape
+ * @brief Size parameters of a generated release document
+ */
+struct ReleaseShape {
+    std::size_t assets = 0;     ///< Entries of the "assets" array
+    std::size_t bodyBytes = 0;  ///< Approximate length of the release notes
+    bool tagLast = false;       ///< Move tag_name behind assets and body (worst case for early exit)
+};
+
+/// A release with no assets and one line of notes (about 1 KB)
+inline constexpr ReleaseShape kSmallRelease{0, 80};
+/// A typical release with binaries for a few platforms (about 17 KB)
+inline constexpr ReleaseShape kMediumRelease{16, 8 * 1024};
+/// A large release such as a compiler or runtime distribution (about 150 KB)
+inline constexpr ReleaseShape kLargeRelease{160, 64 * 1024};
+
+/*!
+ * @brief Builds a /releases/latest response body
+ *
+ * @param repo Repository slug, e.g. "owner/repo"
+ * @param tag Value of the top-level tag_name field
+ * @param shape Number of assets, body length and tag_name position
+ */
+inline std::string release_json(std::string_view repo, std::string_view tag, ReleaseShape shape = {}) {
+    const std::string api = "https://api.github.com/repos/" + std::string(repo);
+    const std::string html = "https://github.com/" + std::string(repo);
+    const std::string tagField = "\"tag_name\":\"" + std::string(tag) + "\",";
+
+    std::string json = "{";
+    json += "\"url\":\"" + api + "/releases/1234567\",";
+    json += "\"assets_url\":\"" + api + "/releases/1234567/assets\",";
+    json += "\"upload_url\":\"https://uploads.github.com/repos/" + std::string(repo) +
+            "/releases/1234567/assets{?name,label}\",";
+    json += "\"html_url\":\"" + html + "/releases/tag/" + std::string(tag) + "\",";
+    json += "\"id\":1234567,";
+    json += "\"author\":{\"login\":\"octocat\",\"id\":1,\"node_id\":\"MDQ6VXNlcjE=\","
+            "\"avatar_url\":\"https://avatars.githubusercontent.com/u/1?v=4\",\"gravatar_id\":\"\","
+            "\"url\":\"https://api.github.com/users/octocat\",\"html_url\":\"https://github.com/octocat\","
+            "\"type\":\"User\",\"site_admin\":false},";
+    json += "\"node_id\":\"RE_kwDOABCDEF4AAAAB\",";
+    if (!shape.tagLast)
+        json += tagField;
+    json += "\"target_commitish\":\"main\",";
+    json += "\"name\":\"Release " + std::string(tag) + "\",";
+    json += "\"draft\":false,\"prerelease\":false,";
+    json += "\"created_at\":\"2026-01-15T10:00:00Z\",\"published_at\":\"2026-01-15T10:30:00Z\",";
+
+    json += "\"assets\":[";
+    for (std::size_t i = 0; i < shape.assets; ++i) {
+        const std::string name = "package-" + std::string(tag) + "-platform" + std::to_string(i) + ".tar.gz";
+        if (i)
+            json += ',';
+        json += "{\"url\":\"" + api + "/releases/assets/" + std::to_string(9000 + i) + "\",";
+        json += "\"id\":" + std::to_string(9000 + i) + ",\"node_id\":\"RA_kwDOABCDEF84AAAA\",";
+        json += "\"name\":\"" + name + "\",\"label\":null,";
+        json += "\"uploader\":{\"login\":\"octocat\",\"id\":1,\"type\":\"User\",\"site_admin\":false},";
+        json += "\"content_type\":\"application/gzip\",\"state\":\"uploaded\",";
+        json += "\"size\":" + std::to_string(1048576 + i) + ",\"download_count\":" + std::to_string(i * 37) + ",";
+        json += "\"created_at\":\"2026-01-15T10:05:00Z\",\"updated_at\":\"2026-01-15T10:06:00Z\",";
+        json += "\"browser_download_url\":\"" + html + "/releases/download/" + std::string(tag) + "/" + name + "\"}";
+    }
+    json += "],";
+
+    json += "\"tarball_url\":\"" + api + "/tarball/" + std::string(tag) + "\",";
+    json += "\"zipball_url\":\"" + api + "/zipball/" + std::string(tag) + "\",";
+
+    // Release notes with the escapes GitHub emits for Markdown
+    constexpr std::string_view line = "* Fixed \\\"tag_name\\\" handling in the parser (#123)\\r\\n";
+    json += "\"body\":\"## What's Changed\\r\\n";
+    for (std::size_t written = 0; written < shape.bodyBytes; written += line.size())
+        json += line;
+    json += "\"";
+
+    if (shape.tagLast)
+        json += "," + tagField.substr(0, tagField.size() - 1);
+    json += "}";
+    return json;
+}
+
+} // namespace ghupdate::fixtures
@@ -5,16 +5,51 @@
  * Tests cover:
  *  - Synchronous update checking with real GitHub API
  *  - Asynchronous update checking
+ *  - Sequential checks over a reusable Client
+ *  - Conditional requests with a ValidatorStore (304 Not Modified)
+ *  - Batch update checking over a worker pool
+ *  - Event-loop update checking via MultiEngine (curl_multi) and co_await
  *  - SemVer version parsing and comparison
+ *  - Streaming tag_name extraction from release JSON
+ *  - GitHub URL normalisation, repository slugs and the on-disk result cache
+ *  - In-process LRU cache (TTL, negative caching, request coalescing)
+ *  - GraphQL batch query building and response splitting
+ *  - Incremental pkt-line parsing of git ls-refs replies
+ *  - Rate limit pacing, retry classification and backoff
+ *  - Cancellation through std::stop_token
+ *  - Periodic re-checks reporting only changes (Watcher)
+ *  - Per-phase latency histograms and the metrics registry
+ *  - Offline end-to-end checks against a local mock of the GitHub API
+ *  - Custom transports replacing libcurl
  *  - Error handling for invalid inputs
  *
- * @note Tests require network connectivity to GitHub API
+ * @note Tests require network connectivity to GitHub API. Tests using the
+ *       mock GitHub API or the /metrics endpoint are built only where POSIX
+ *       sockets are available.
  */
 
 #include <check_gh-update.hpp>
+#include <ghupdate/multi_engine.hpp>
+#include <ghupdate/disk_cache.hpp>
+#include <ghupdate/update_cache.hpp>
+#include <ghupdate/graphql.hpp>
+#include <ghupdate/git_refs.hpp>
+#include <ghupdate/coro.hpp>
+#include <ghupdate/watcher.hpp>
+#include <ghupdate/latency_histogram.hpp>
+#include <ghupdate/metrics_registry.hpp>
+#include <release_fixtures.hpp>
+// The /metrics endpoint and the mock GitHub API need POSIX sockets
+#if __has_include(<sys/socket.h>)
+#define GHUPDATE_TEST_SOCKETS 1
+#include <ghupdate/metrics_server.hpp>
+#include <mock_github_server.hpp>
+#endif
 #include <iostream>
 #include <cassert>
 #include <chrono>
+#include <cstdio>
+#include <latch>
 
 // Test counter for simple reporting
 int tests_passed = 0;
@@ -74,6 +109,1106 @@ void test_semver_comparison() {
     }
 }
 
+/*!
+ * @brief Compile-time SemVer parsing and edge cases
+ *
+ * The parser picks the first "x.y[.z]" sequence anywhere in the string and
+ * reports overflowing components like std::stoi did
+ */
+void test_semver_constexpr() {
+    using namespace ghupdate::literals;
+    static_assert("v3.11.2"_semver == ghupdate::SemVer{3, 11, 2});
+    static_assert(ghupdate::SemVer::parse("release-2.0.x") == ghupdate::SemVer{2, 0, 0});
+
+    bool pass = ghupdate::SemVer::parse("tag 10.20.30") == ghupdate::SemVer{10, 20, 30} &&
+                ghupdate::SemVer::parse("1-2.3") == ghupdate::SemVer{2, 3, 0};
+
+    try {
+        ghupdate::SemVer::parse("v1.");
+        pass = false;
+    } catch (const std::runtime_error&) {
+    }
+    try {
+        ghupdate::SemVer::parse("1.99999999999");
+        pass = false;
+    } catch (const std::out_of_range&) {
+    }
+
+    print_result("SemVer constexpr parsing", pass);
+}
+
+/*!
+ * @brief SemVer 2.0.0 pre-release precedence and build metadata
+ *
+ * Uses the precedence chain from the SemVer 2.0.0 specification
+ */
+void test_semver_prerelease() {
+    using namespace ghupdate::literals;
+    static_assert("1.0.0-rc.1"_semver < "1.0.0"_semver);
+    static_assert("1.0.0+build.5"_semver == "1.0.0"_semver);
+
+    const char* chain[] = {
+        "1.0.0-alpha", "1.0.0-alpha.1", "1.0.0-alpha.beta", "1.0.0-beta",
+        "1.0.0-beta.2", "1.0.0-beta.11", "1.0.0-rc.1", "1.0.0",
+    };
+    bool pass = true;
+    for (std::size_t i = 0; i + 1 < std::size(chain); ++i) {
+        pass = pass && ghupdate::SemVer::parse(chain[i]) < ghupdate::SemVer::parse(chain[i + 1]);
+    }
+
+    auto v = ghupdate::SemVer::parse("v2.1.0-rc.2+exp.sha.5114f85");
+    pass = pass && v.prerelease() == "rc.2" && v.build() == "exp.sha.5114f85" &&
+           v.is_prerelease() && v.to_string() == "2.1.0-rc.2+exp.sha.5114f85" &&
+           ghupdate::SemVer::parse("1.0.0-2") < ghupdate::SemVer::parse("1.0.0-10") &&
+           ghupdate::SemVer::parse("1.0.0-99999999999") < ghupdate::SemVer::parse("1.0.0-100000000000") &&
+           ghupdate::SemVer::parse("1.2.3-rc.") == ghupdate::SemVer::parse("1.2.3-rc");
+
+    // Suffixes longer than the inline buffer are valid SemVer as well
+    constexpr std::string_view longPre = "alpha.build-matrix.linux-x86-64.gcc-12.release-with-debinfo.1";
+    static_assert(longPre.size() > ghupdate::SemVer::kSuffixCapacity);
+    static_assert(ghupdate::SemVer::parse("1.0.0-alpha.build-matrix.linux-x86-64.gcc-12.release-with-debinfo.1") <
+                  ghupdate::SemVer::parse("1.0.0-alpha.build-matrix.linux-x86-64.gcc-12.release-with-debinfo.2"));
+    auto longer = ghupdate::SemVer::parse("1.0.0-" + std::string(longPre) + "+sha.5114f85");
+    auto copy = longer;
+    auto other = ghupdate::SemVer::parse("1.0.0-alpha");
+    other = copy;
+    auto moved = std::move(copy);
+    pass = pass && longer.prerelease() == longPre && longer.build() == "sha.5114f85" &&
+           other.prerelease() == longPre && moved == longer && moved.to_string() == longer.to_string() &&
+           longer < ghupdate::SemVer::parse("1.0.0") && ghupdate::SemVer::parse("1.0.0-alpha") < longer;
+
+    // Moved-from versions that gave up a heap suffix stay valid (as a plain release)
+    auto assigned = ghupdate::SemVer::parse("2.0.0");
+    assigned = std::move(other);
+    const auto movedFromCopy = copy;
+    pass = pass && assigned == longer && copy.to_string() == "1.0.0" && !copy.is_prerelease() &&
+           copy == ghupdate::SemVer::parse("1.0.0") && movedFromCopy == copy &&
+           other.to_string() == "1.0.0" && other.build().empty() && longer < other;
+
+    print_result("SemVer pre-release precedence", pass);
+}
+
+/*!
+ * @brief Streaming tag_name extraction
+ *
+ * Feeds a release document byte by byte; nested tag_name keys and
+ * occurrences inside other strings must be ignored
+ */
+void test_tag_extraction() {
+    try {
+        const std::string release = R"({"url": "https://x/tag_name", "id": 7,
+            "author": {"tag_name": "wrong"}, "assets": [{"tag_name": "wrong"}, "tag_name"],
+            "body": "escaped \" quote, \u00e9 and \ud83d\ude80",
+            "tag_name": "v3.11.\u0033", "message": "not reached"})";
+
+        ghupdate::ReleaseTagExtractor extractor;
+        bool done = false;
+        for (char c : release)
+            done = extractor.feed(std::string_view(&c, 1));
+
+        bool pass = done && extractor.tag() == "v3.11.3" && !extractor.message();
+
+        ghupdate::ReleaseTagExtractor error;
+        error.feed(R"({"message": "API rate limit exceeded", "documentation_url": "x"})");
+        try {
+            error.tag_or_throw();
+            pass = false;
+        } catch (const std::runtime_error& e) {
+            pass = pass && std::string(e.what()) == "GitHub API error: API rate limit exceeded";
+        }
+
+        pass = pass && ghupdate::parse_latest_tag(R"({"tag_name":"v1.0.0"})") == "v1.0.0";
+
+        print_result("Streaming tag_name extraction", pass);
+    } catch (const std::exception& e) {
+        std::cerr << "  Exception: " << e.what() << "\n";
+        print_result("Streaming tag_name extraction", false);
+    }
+}
+
+/*!
+ * @brief GitHub URL normalisation and interning
+ *
+ * All supported spellings map to the same interned API URL
+ */
+void test_url_normalization() {
+    try {
+        const std::string expected = "https://api.github.com/repos/nlohmann/json/releases/latest";
+        const char* forms[] = {
+            "https://github.com/nlohmann/json",
+            "http://www.github.com/nlohmann/json/",
+            "https://github.com/nlohmann/json.git",
+            "https://github.com/nlohmann/json/tree/develop/include",
+            "git@github.com:nlohmann/json.git",
+            "ssh://git@github.com/nlohmann/json.git",
+            "ssh://git@github.com:22/nlohmann/json",
+        };
+        bool pass = true;
+        for (const char* form : forms) {
+            pass = pass && ghupdate::to_github_api_url(form) == expected;
+        }
+
+        auto first = ghupdate::to_github_api_url_view(forms[0]);
+        auto again = ghupdate::to_github_api_url_view(forms[4]);
+        pass = pass && first.data() == again.data() &&
+               ghupdate::to_github_api_url_view(expected) == expected;
+
+        for (const char* bad : {"https://gitlab.com/a/b", "https://github.com/owner", "https://notgithub.com/a/b"}) {
+            try {
+                ghupdate::to_github_api_url(bad);
+                pass = false;
+            } catch (const std::runtime_error&) {
+            }
+        }
+        print_result("GitHub URL normalisation", pass);
+    } catch (const std::exception& e) {
+        std::cerr << "  Exception: " << e.what() << "\n";
+        print_result("GitHub URL normalisation", false);
+    }
+}
+
+/*!
+ * @brief Repository slugs and on-disk cache freshness
+ */
+void test_disk_cache() {
+    try {
+        using namespace std::chrono_literals;
+        auto dir = std::filesystem::temp_directory_path() / "gh-update-checker-test-cache";
+        std::filesystem::remove_all(dir);
+
+        auto key = ghupdate::github_repo_slug("https://github.com/NLohmann/JSON.git");
+        bool pass = key == "nlohmann/json" &&
+                    ghupdate::github_repo_slug(
+                        "https://api.github.com/repos/nlohmann/json/releases/latest") == key;
+
+        ghupdate::DiskCache fresh(dir, 60s);
+        ghupdate::DiskCache stale(dir, 0s, 60s);
+        ghupdate::DiskCache expired(dir, 0s);
+
+        pass = pass && fresh.lookup(key).state == ghupdate::DiskCache::State::Miss;
+        fresh.store(key, "v3.11.3");
+
+        auto hit = fresh.lookup(key);
+        pass = pass && hit.state == ghupdate::DiskCache::State::Fresh && hit.latestVersion == "v3.11.3" &&
+               stale.lookup(key).state == ghupdate::DiskCache::State::Stale &&
+               expired.lookup(key).state == ghupdate::DiskCache::State::Miss;
+
+        pass = pass && stale.try_claim_revalidation(key) && !stale.try_claim_revalidation(key);
+        stale.release_revalidation(key);
+        pass = pass && stale.try_claim_revalidation(key);
+        stale.release_revalidation(key);
+
+        // A claim abandoned by a crashed process is broken by exactly one of the racers
+        const auto lockFile = dir / "nlohmann" / "json.lock";
+        for (int round = 0; round < 50; ++round) {
+            pass = pass && stale.try_claim_revalidation(key);
+            std::filesystem::last_write_time(lockFile, std::filesystem::file_time_type::clock::now() - 2min);
+            std::atomic<int> winners{0};
+            std::latch start(8);
+            {
+                std::vector<std::jthread> racers;
+                for (int i = 0; i < 8; ++i) {
+                    racers.emplace_back([&] {
+                        start.arrive_and_wait();
+                        winners += stale.try_claim_revalidation(key) ? 1 : 0;
+                    });
+                }
+            }
+            pass = pass && winners == 1;
+            stale.release_revalidation(key);
+        }
+
+        // Keys must not address files outside the cache directory
+        for (const char* bad : {"../escape", "owner/..", "owner/repo/extra", "/etc/passwd", "owner\\repo"}) {
+            bool rejected = false;
+            try {
+                fresh.store(bad, "v1.0.0");
+            } catch (const std::runtime_error& e) {
+                rejected = std::string_view(e.what()).starts_with("Invalid cache key");
+            }
+            pass = pass && rejected;
+        }
+        pass = pass && !std::filesystem::exists(dir.parent_path() / "escape.cache");
+
+        std::filesystem::remove_all(dir);
+        print_result("Disk cache", pass);
+    } catch (const std::exception& e) {
+        std::cerr << "  Exception: " << e.what() << "\n";
+        print_result("Disk cache", false);
+    }
+}
+
+/*!
+ * @brief In-process LRU cache with a fake fetcher
+ *
+ * Concurrent lookups of one repository share a single fetch, definitive
+ * failures are cached but transient ones are not, and the least recently
+ * used entry is evicted at capacity
+ */
+void test_update_cache() {
+    try {
+        using namespace std::chrono_literals;
+        std::atomic<int> fetches{0};
+        ghupdate::UpdateCache cache({.capacity = 2, .ttl = 1min, .errorTtl = 1min},
+            [&](const std::string& apiUrl) -> std::string {
+                ++fetches;
+                std::this_thread::sleep_for(50ms);
+                if (apiUrl.find("/broken/") != std::string::npos)
+                    throw ghupdate::ApiError("GitHub API error: Not Found", 404);
+                return "v2.0.0";
+            });
+
+        std::vector<std::jthread> callers;
+        std::atomic<int> updates{0};
+        for (int i = 0; i < 4; ++i) {
+            callers.emplace_back([&] {
+                if (cache.check("https://github.com/owner/repo", "1.0.0").hasUpdate)
+                    ++updates;
+            });
+        }
+        callers.clear();
+        bool pass = fetches == 1 && updates == 4;
+
+        int errors = 0;
+        for (int i = 0; i < 2; ++i) {
+            try {
+                cache.check("https://github.com/owner/broken", "1.0.0");
+            } catch (const std::runtime_error&) {
+                ++errors;
+            }
+        }
+        pass = pass && errors == 2 && fetches == 2;
+
+        cache.check("https://github.com/owner/other", "3.0.0");
+        cache.check("https://api.github.com/repos/owner/other/releases/latest", "1.0.0");
+        pass = pass && fetches == 3 && cache.size() == 2;
+
+        cache.check("https://github.com/owner/repo", "1.0.0");
+        pass = pass && fetches == 4;
+
+        // A fetcher throwing a non-std exception still completes the flight
+        ghupdate::UpdateCache odd({}, [](const std::string&) -> std::string { throw 42; });
+        int oddErrors = 0;
+        for (int i = 0; i < 2; ++i) {
+            try {
+                odd.check("https://github.com/owner/odd", "1.0.0");
+            } catch (const std::runtime_error& e) {
+                oddErrors += std::string_view(e.what()) == "Update check failed: unknown error";
+            }
+        }
+        pass = pass && oddErrors == 2;
+
+        // Outages, rate limits and cancellations must not hide the next answer
+        std::atomic<int> transientFetches{0};
+        ghupdate::UpdateCache transient({.errorTtl = 1min}, [&](const std::string& apiUrl) -> std::string {
+            ++transientFetches;
+            if (apiUrl.find("/flaky/") != std::string::npos)
+                throw ghupdate::ApiError("GitHub API error: HTTP 503", 503);
+            if (apiUrl.find("/limited/") != std::string::npos)
+                throw ghupdate::ApiError("GitHub API error: API rate limit exceeded", 403);
+            throw std::runtime_error("Check cancelled");
+        });
+        int transientErrors = 0;
+        for (const char* repo : {"owner/flaky", "owner/limited", "owner/cancelled"}) {
+            for (int i = 0; i < 2; ++i) {
+                try {
+                    transient.check(std::string("https://github.com/") + repo, "1.0.0");
+                } catch (const std::runtime_error&) {
+                    ++transientErrors;
+                }
+            }
+        }
+        pass = pass && transientErrors == 6 && transientFetches == 6 && transient.size() == 0;
+
+        print_result("In-process update cache", pass);
+    } catch (const std::exception& e) {
+        std::cerr << "  Exception: " << e.what() << "\n";
+        print_result("In-process update cache", false);
+    }
+}
+
+/*!
+ * @brief GraphQL query building and response splitting
+ *
+ * Offline: checks the aliased query and per-repository results including
+ * unknown repositories and repositories without releases
+ */
+void test_graphql_batch() {
+    try {
+        std::vector<ghupdate::graphql::RepoName> repos = {
+            ghupdate::graphql::repo_name("https://github.com/NLohmann/json"),
+            {"curl", "curl"},
+            {"owner", "missing"},
+        };
+        auto body = nlohmann::json::parse(ghupdate::graphql::build_query(repos));
+        std::string query = body.at("query");
+        bool pass = query.find(R"(r0:repository(owner:"nlohmann",name:"json"){latestRelease{tagName}})") !=
+                        std::string::npos &&
+                    query.find(R"(r2:repository(owner:"owner",name:"missing"))") != std::string::npos;
+
+        auto results = ghupdate::graphql::parse_response(R"({
+            "data": {"r0": {"latestRelease": {"tagName": "v3.11.3"}},
+                     "r1": {"latestRelease": null},
+                     "r2": null},
+            "errors": [{"type": "NOT_FOUND", "path": ["r2"],
+                        "message": "Could not resolve to a Repository"}]})", repos.size());
+        pass = pass && results.size() == 3 && results[0] && *results[0] == "v3.11.3" &&
+               !results[1] && !results[2] &&
+               results[2].error() == "GitHub API error: Could not resolve to a Repository";
+
+        try {
+            ghupdate::graphql::parse_response(R"({"message": "Bad credentials"})", 1);
+            pass = false;
+        } catch (const std::runtime_error&) {
+        }
+
+        print_result("GraphQL batch query", pass);
+    } catch (const std::exception& e) {
+        std::cerr << "  Exception: " << e.what() << "\n";
+        print_result("GraphQL batch query", false);
+    }
+}
+
+/*!
+ * @brief Incremental ls-refs (pkt-line) tag selection
+ *
+ * Feeds a protocol v2 reply byte by byte; non-version tags, peeled entries
+ * and pre-releases must not win
+ */
+void test_ls_refs_scanner() {
+    auto pkt = [](std::string payload) {
+        char length[5];
+        std::snprintf(length, sizeof(length), "%04zx", payload.size() + 4);
+        return length + payload;
+    };
+    const std::string oid(40, 'a');
+    std::string reply;
+    for (const char* ref : {"v1.9.0", "latest", "v1.10.0", "v1.10.0^{}", "v2.0.0-rc.1", "release-1.2"})
+        reply += pkt(oid + " refs/tags/" + ref + "\n");
+    reply += "0000";
+
+    ghupdate::LsRefsTagScanner scanner;
+    bool finished = false;
+    for (char c : reply)
+        finished = scanner.feed(std::string_view(&c, 1));
+
+    ghupdate::LsRefsTagScanner withPre(true);
+    withPre.feed(reply);
+
+    ghupdate::LsRefsTagScanner failing;
+    failing.feed(pkt("ERR access denied\n"));
+
+    // Without the flush-pkt the remaining tags are unknown
+    ghupdate::LsRefsTagScanner truncated;
+    truncated.feed(std::string_view(reply).substr(0, reply.size() - 4));
+    bool truncatedRejected = false;
+    try {
+        truncated.tag_or_throw();
+    } catch (const std::runtime_error& e) {
+        truncatedRejected = std::string_view(e.what()) == "git error: truncated ls-refs response";
+    }
+
+    bool pass = finished && scanner.tag_or_throw() == "v1.10.0" &&
+                withPre.tag() == "v2.0.0-rc.1" &&
+                failing.done() && failing.error() == "access denied" &&
+                !truncated.done() && truncatedRejected;
+    print_result("ls-refs tag scanner", pass);
+}
+
+/*!
+ * @brief Rate limit pacing from X-RateLimit-* headers
+ *
+ * Slots are only spread out while demand exceeds the remaining budget, and
+ * an exhausted budget makes callers wait for the reset instead of failing
+ */
+void test_rate_limit_scheduler() {
+    try {
+        using namespace std::chrono_literals;
+        using Clock = ghupdate::RateLimitScheduler::Clock;
+
+        ghupdate::RateLimitScheduler relaxed;
+        relaxed.update({.remaining = 100, .reset = Clock::now() + 100s}, 200);
+        relaxed.expect(10);
+        auto slot = relaxed.reserve();
+        bool pass = slot <= Clock::now() && relaxed.remaining() == 99;
+
+        ghupdate::RateLimitScheduler paced;
+        paced.update({.remaining = 10, .reset = Clock::now() + 100s}, 200);
+        paced.expect(20);
+        auto first = paced.reserve();
+        auto second = paced.reserve();
+        pass = pass && second - first >= 9s && second - first <= 11s;
+
+        ghupdate::RateLimitScheduler exhausted({.maxWait = 10s});
+        exhausted.update({.remaining = 0, .reset = Clock::now() + 1h}, 403);
+        try {
+            exhausted.reserve();
+            pass = false;
+        } catch (const std::runtime_error&) {
+        }
+
+        ghupdate::RateLimitScheduler retry;
+        retry.update({.retryAfter = 30s}, 429);
+        pass = pass && retry.reserve() >= Clock::now() + 29s;
+
+        print_result("Rate limit scheduler", pass);
+    } catch (const std::exception& e) {
+        std::cerr << "  Exception: " << e.what() << "\n";
+        print_result("Rate limit scheduler", false);
+    }
+}
+
+/*!
+ * @brief Retry classification and exponential backoff with jitter
+ */
+void test_retry_policy() {
+    using namespace std::chrono_literals;
+    ghupdate::RetryPolicy policy{.maxAttempts = 4, .initialBackoff = 100ms, .maxBackoff = 1s, .multiplier = 2.0};
+
+    ghupdate::HttpResponse unavailable;
+    unavailable.status = 503;
+    ghupdate::HttpResponse notFound;
+    notFound.status = 404;
+    ghupdate::HttpResponse throttled;
+    throttled.status = 429;
+    throttled.rateLimit.retryAfter = 1s;
+
+    auto first = ghupdate::detail::retry_delay(policy, 1, CURLE_OK, unavailable);
+    auto third = ghupdate::detail::retry_delay(policy, 3, CURLE_OPERATION_TIMEDOUT, notFound);
+    auto waited = ghupdate::detail::retry_delay(policy, 1, CURLE_OK, throttled);
+    throttled.rateLimit.retryAfter = 1h;
+
+    bool pass = first && *first <= 100ms && third && *third <= 400ms &&
+                waited && *waited >= 1s &&
+                !ghupdate::detail::retry_delay(policy, 1, CURLE_OK, notFound) &&
+                !ghupdate::detail::retry_delay(policy, 4, CURLE_OK, unavailable) &&
+                !ghupdate::detail::retry_delay(policy, 1, CURLE_OK, throttled) &&
+                !ghupdate::detail::retry_delay(policy, 1, CURLE_URL_MALFORMAT, unavailable);
+    print_result("Retry policy", pass);
+}
+
+/*!
+ * @brief Cooperative cancellation through std::stop_token
+ *
+ * A stopped check fails before any network I/O, an interrupted backoff
+ * returns immediately, and a request that is already waiting for a slow
+ * server is aborted by the transfer's progress callback
+ */
+void test_stop_token() {
+    using namespace std::chrono_literals;
+    std::stop_source source;
+    source.request_stop();
+
+    bool pass = false;
+    auto start = std::chrono::steady_clock::now();
+    try {
+        ghupdate::check_github_update("https://github.com/nlohmann/json", "3.11.2",
+                                      {.stopToken = source.get_token()});
+    } catch (const std::runtime_error& e) {
+        pass = std::string(e.what()) == "Check cancelled";
+    }
+
+    pass = pass && !ghupdate::detail::sleep_for(10s, source.get_token()) &&
+           std::chrono::steady_clock::now() - start < 1s;
+
+#ifdef GHUPDATE_TEST_SOCKETS
+    // Stop while the request is in flight: the server takes 10 s to answer
+    ghupdate::fixtures::MockGitHubServer server({.latency = 10s});
+    server.set_release("mock/slow", "v1.0.0", ghupdate::fixtures::kSmallRelease);
+    std::stop_source inFlight;
+    auto stopper = std::jthread([&] {
+        std::this_thread::sleep_for(200ms);
+        inFlight.request_stop();
+    });
+    bool cancelled = false;
+    start = std::chrono::steady_clock::now();
+    try {
+        ghupdate::check_github_update(server.api_url("mock/slow"), "1.0.0", {.stopToken = inFlight.get_token()});
+    } catch (const std::runtime_error& e) {
+        cancelled = std::string(e.what()) == "Check cancelled";
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    pass = pass && cancelled && server.stats().connections == 1 && elapsed < 3s;
+#endif
+
+    print_result("Stop token cancellation", pass);
+}
+
+/*!
+ * @brief Minimal fire-and-forget coroutine type for the co_await test
+ */
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+DetachedTask await_check(ghupdate::MultiEngine& engine, std::string url,
+                         ghupdate::CoroutineExecutor executor, std::promise<std::string>& out) {
+    try {
+        auto info = co_await ghupdate::check_github_update_co(engine, url, "1.0.0", std::move(executor));
+        out.set_value(info.latestVersion);
+    } catch (const std::exception& e) {
+        out.set_value(std::string("error: ") + e.what());
+    }
+}
+
+/*!
+ * @brief Awaiting a MultiEngine check from a coroutine
+ *
+ * Offline: an invalid URL completes on the event loop without network I/O;
+ * the error must be rethrown by co_await after resuming through the executor.
+ * An executor that throws resumes the coroutine inline with its exception.
+ */
+void test_coroutine_check() {
+    ghupdate::MultiEngine engine;
+    std::atomic<int> resumed{0};
+    std::promise<std::string> out;
+    auto future = out.get_future();
+
+    await_check(engine, "https://gitlab.com/owner/repo",
+                [&](std::coroutine_handle<> handle) {
+                    ++resumed;
+                    handle.resume();
+                },
+                out);
+
+    bool pass = future.wait_for(std::chrono::seconds(5)) == std::future_status::ready &&
+                future.get() == "error: Invalid GitHub URL: https://gitlab.com/owner/repo" &&
+                resumed == 1;
+
+    std::promise<std::string> rejectedOut;
+    auto rejected = rejectedOut.get_future();
+    await_check(engine, "https://gitlab.com/owner/repo",
+                [](std::coroutine_handle<>) { throw std::runtime_error("executor shut down"); },
+                rejectedOut);
+    pass = pass && rejected.wait_for(std::chrono::seconds(5)) == std::future_status::ready &&
+           rejected.get() == "error: executor shut down";
+
+    engine.wait_idle();
+    print_result("Coroutine check", pass);
+}
+
+/*!
+ * @brief Periodic re-checks with change-only reporting
+ *
+ * Offline: an invalid URL fails on every cycle of the 1 s interval, but the
+ * unchanged error must be reported only once
+ */
+void test_watcher() {
+    ghupdate::Watcher watcher;
+    watcher.add({"https://gitlab.com/owner/repo", "1.0.0"}, std::chrono::seconds(1));
+
+    std::vector<std::string> events;
+    {
+        std::jthread thread([&](std::stop_token stop) {
+            watcher.run(stop, [&](const ghupdate::WatchEvent& event) {
+                events.push_back(event.result ? event.result->latestVersion : event.result.error());
+            });
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(2500));
+    }
+
+    bool pass = events.size() == 1 &&
+                events[0] == "Invalid GitHub URL: https://gitlab.com/owner/repo";
+    print_result("Watcher change detection", pass);
+}
+
+/*!
+ * @brief Log-linear latency histograms
+ *
+ * Bucket bounds must be contiguous and percentiles accurate to one bucket
+ */
+void test_latency_histogram() {
+    using ghupdate::LatencyHistogram;
+    bool pass = true;
+    for (std::uint64_t us = 1; us < 10'000'000; us = us * 3 / 2 + 1) {
+        std::size_t bucket = LatencyHistogram::bucket_of(us);
+        pass = pass && us <= LatencyHistogram::upper_bound_of(bucket) &&
+               us > LatencyHistogram::upper_bound_of(bucket - 1);
+    }
+
+    LatencyHistogram h;
+    for (int ms = 1; ms <= 100; ++ms)
+        h.record(std::chrono::milliseconds(ms));
+    auto within = [](std::chrono::microseconds value, double expectedMs) {
+        double ms = static_cast<double>(value.count()) / 1000.0;
+        return ms >= expectedMs && ms <= expectedMs * 1.125;
+    };
+    pass = pass && h.count() == 100 && h.max() == std::chrono::milliseconds(100) &&
+           within(h.percentile(0.5), 50) && within(h.percentile(0.99), 99) &&
+           h.mean() == std::chrono::microseconds(50'500);
+
+    ghupdate::BatchMetrics batch;
+    ghupdate::UpdateInfo info;
+    info.metrics = ghupdate::CheckMetrics{.firstByte = std::chrono::milliseconds(7), .attempts = 2};
+    batch.add(ghupdate::CheckResult(info));
+    batch.add(ghupdate::CheckResult(std::unexpected(std::string("failed"))));
+    pass = pass && batch.firstByte.count() == 1 && batch.attempts == 2 && batch.failures == 1 &&
+           batch.summary().find("first byte") != std::string::npos;
+
+    print_result("Latency histogram", pass);
+}
+
+/*!
+ * @brief Metrics registry exposition and /metrics endpoint
+ *
+ * Offline: a failing check is counted as an error, histogram buckets are
+ * cumulative, and the server on an ephemeral port answers a scrape
+ */
+void test_metrics_registry() {
+    ghupdate::MetricsRegistry registry;
+    try {
+        ghupdate::Client().check("https://gitlab.com/owner/repo", "1.0.0", {.metrics = &registry});
+    } catch (const std::exception&) {
+    }
+    registry.cacheHits.inc();
+    registry.observe(ghupdate::Phase::Total, std::chrono::milliseconds(3));
+    registry.observe(ghupdate::Phase::Total, std::chrono::seconds(60));
+
+    const std::string om = registry.exposition();
+    const std::string prom = registry.exposition(ghupdate::MetricsRegistry::Format::Prometheus);
+    bool pass = registry.checkErrors.value() == 1 && registry.requests.value() == 0 &&
+                om.find("ghupdate_checks_total{outcome=\"error\"} 1\n") != std::string::npos &&
+                om.find("# TYPE ghupdate_cache_hits counter\n") != std::string::npos &&
+                om.find("ghupdate_phase_duration_seconds_bucket{phase=\"total\",le=\"0.0025\"} 0\n") != std::string::npos &&
+                om.find("ghupdate_phase_duration_seconds_bucket{phase=\"total\",le=\"0.005\"} 1\n") != std::string::npos &&
+                om.find("ghupdate_phase_duration_seconds_bucket{phase=\"total\",le=\"+Inf\"} 2\n") != std::string::npos &&
+                om.find("ghupdate_phase_duration_seconds_sum{phase=\"total\"} 60.003\n") != std::string::npos &&
+                om.ends_with("# EOF\n") &&
+                prom.find("# TYPE ghupdate_cache_hits_total counter\n") != std::string::npos &&
+                prom.find("# EOF") == std::string::npos;
+
+#ifdef GHUPDATE_TEST_SOCKETS
+    ghupdate::MetricsServer server(registry, "127.0.0.1", 0);
+    std::string response;
+    int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(server.port());
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof address) == 0) {
+        const std::string request = "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n";
+        ::send(fd, request.data(), request.size(), 0);
+        char buffer[4096];
+        for (ssize_t n; (n = ::recv(fd, buffer, sizeof buffer, 0)) > 0;)
+            response.append(buffer, static_cast<std::size_t>(n));
+    }
+    ::close(fd);
+    pass = pass && response.starts_with("HTTP/1.1 200 OK\r\n") && response.ends_with(prom);
+#endif
+
+    print_result("Metrics registry", pass);
+}
+
+#ifdef GHUPDATE_TEST_SOCKETS
+/*!
+ * @brief End-to-end checks against the mock GitHub API
+ *
+ * Offline: sync, async and batch checks, ETag revalidation, a retried
+ * injected 503 and an unknown repository
+ */
+void test_mock_server() {
+    try {
+        ghupdate::fixtures::MockGitHubServer server({.errorEvery = 4});
+        server.set_release("mock/app", "v2.1.0", ghupdate::fixtures::kSmallRelease);
+        const std::string url = server.api_url("mock/app");
+
+        // Requests 1 and 2
+        auto info = ghupdate::check_github_update(url, "2.0.0");
+        auto async = ghupdate::check_github_update_async(url, "2.1.0").get();
+        bool pass = info.hasUpdate && info.latestVersion == "v2.1.0" && !async.hasUpdate;
+
+        // Request 3 stores the ETag, request 4 fails with 503 and is retried as a 304
+        ghupdate::MetricsRegistry registry;
+        ghupdate::ValidatorStore validators;
+        const ghupdate::CheckOptions options{.validators = &validators,
+                                             .retry = {.initialBackoff = std::chrono::milliseconds(1)},
+                                             .metrics = &registry};
+        ghupdate::Client client;
+        client.check(url, "2.0.0", options);
+        auto revalidated = client.check(url, "2.0.0", options);
+        pass = pass && revalidated.notModified && revalidated.latestVersion == "v2.1.0" &&
+               registry.retries.value() == 1 && registry.notModified.value() == 1 &&
+               registry.rateLimitRemaining.has_value();
+
+        const std::vector<ghupdate::RepoCheck> repos = {{url, "2.0.0"}, {server.api_url("mock/missing"), "1.0.0"}};
+        auto results = ghupdate::check_github_updates(repos, {.concurrency = 2});
+        pass = pass && results.size() == 2 && results[0] && results[0]->hasUpdate && !results[1] &&
+               results[1].error() == "GitHub API error: Not Found";
+
+        const auto stats = server.stats();
+        pass = pass && stats.notModified == 1 && stats.requests >= 7;
+        print_result("Mock GitHub API end-to-end", pass);
+    } catch (const std::exception& e) {
+        std::cerr << "  Exception: " << e.what() << "\n";
+        print_result("Mock GitHub API end-to-end", false);
+    }
+}
+/*!
+ * @brief MultiEngine error responses against the mock GitHub API
+ *
+ * Offline: a 404 and an injected 503 are reported with GitHub's message
+ * like Client::latest_release() does, and EngineOptions::transferTimeout
+ * cuts a stalled response short
+ */
+void test_multi_engine_errors() {
+    auto error_of = [](std::future<ghupdate::UpdateInfo> future) {
+        try {
+            future.get();
+            return std::string();
+        } catch (const std::runtime_error& e) {
+            return std::string(e.what());
+        }
+    };
+
+    try {
+        ghupdate::fixtures::MockGitHubServer server({.errorEvery = 3});
+        server.set_release("mock/app", "v2.0.0", ghupdate::fixtures::kSmallRelease);
+
+        // One transfer at a time, so that the third request is the injected error
+        ghupdate::MultiEngine engine({.maxInFlight = 1, .http2Multiplex = false});
+        auto found = engine.submit(server.api_url("mock/app"), "1.0.0");
+        auto missing = engine.submit(server.api_url("mock/missing"), "1.0.0");
+        auto injected = engine.submit(server.api_url("mock/app"), "1.0.0");
+        bool pass = found.get().latestVersion == "v2.0.0" &&
+                    error_of(std::move(missing)) == "GitHub API error: Not Found" &&
+                    error_of(std::move(injected)) == "GitHub API error: Injected error";
+
+        ghupdate::fixtures::MockGitHubServer slow({.latency = std::chrono::seconds(5)});
+        slow.set_release("mock/app", "v2.0.0");
+        ghupdate::MultiEngine impatient({.http2Multiplex = false,
+                                         .transferTimeout = std::chrono::milliseconds(100)});
+        const auto start = std::chrono::steady_clock::now();
+        pass = pass && error_of(impatient.submit(slow.api_url("mock/app"), "1.0.0")) == "HTTP request failed" &&
+               std::chrono::steady_clock::now() - start < std::chrono::seconds(3);
+
+        print_result("MultiEngine error responses", pass);
+    } catch (const std::exception& e) {
+        std::cerr << "  Exception: " << e.what() << "\n";
+        print_result("MultiEngine error responses", false);
+    }
+}
+
+/*!
+ * @brief GraphQL batch checks against the mock GitHub API
+ *
+ * Offline: duplicates are resolved once, the unique repositories are split
+ * into batches of three, and an injected error fails only the entries of its
+ * batch; a wrong token fails every entry
+ */
+void test_graphql_mock() {
+    try {
+        ghupdate::fixtures::MockGitHubServer server({.errorEvery = 3, .token = "test-token"});
+        for (int i = 0; i < 6; ++i)
+            server.set_release("mock/r" + std::to_string(i), "v1." + std::to_string(i) + ".0");
+        auto repo = [](std::string_view name) { return "https://github.com/" + std::string(name); };
+
+        // Request 1
+        const std::vector<ghupdate::RepoCheck> two = {{repo("mock/r0"), "1.0.0"}, {repo("mock/r1"), "1.0.0"}};
+        auto denied = ghupdate::check_github_updates_graphql(
+            two, {.endpoint = server.graphql_url(), .token = "wrong-token", .batchSize = 3});
+        bool pass = denied.size() == 2 && !denied[0] && !denied[1] &&
+                    denied[0].error() == "GitHub API error: Bad credentials";
+
+        // Seven unique repositories in batches of three: requests 2, 3 (injected error) and 4
+        const std::vector<ghupdate::RepoCheck> repos = {
+            {repo("mock/r0"), "0.9.0"}, {repo("mock/r1"), "1.0.0"}, {repo("mock/missing"), "1.0.0"},
+            {repo("Mock/R0"), "9.0.0"}, {repo("mock/r2"), "1.0.0"}, {repo("mock/r3"), "1.0.0"},
+            {repo("mock/r1"), "1.0.0"}, {repo("mock/r4"), "1.0.0"}, {repo("mock/r5"), "1.0.0"},
+            {repo("mock/r5"), "2.0.0"},
+        };
+        auto results = ghupdate::check_github_updates_graphql(
+            repos, {.endpoint = server.graphql_url(), .token = "test-token", .batchSize = 3});
+        pass = pass && results.size() == repos.size() && results[0] && results[0]->hasUpdate &&
+               results[0]->latestVersion == "v1.0.0" && results[1] && results[1]->latestVersion == "v1.1.0" &&
+               !results[2] && results[2].error() ==
+                                  "GitHub API error: Could not resolve to a Repository with the name 'mock/missing'." &&
+               results[3] && !results[3]->hasUpdate && results[3]->latestVersion == "v1.0.0" &&
+               results[6] && results[6]->hasUpdate && results[6]->latestVersion == "v1.1.0" &&
+               results[8] && results[8]->hasUpdate && results[8]->latestVersion == "v1.5.0" &&
+               results[9] && !results[9]->hasUpdate;
+        for (std::size_t i : {4, 5, 7})
+            pass = pass && !results[i] && results[i].error() == "GitHub API error: Injected error";
+
+        pass = pass && server.stats().requests == 4;
+        print_result("GraphQL batch checks against the mock API", pass);
+    } catch (const std::exception& e) {
+        std::cerr << "  Exception: " << e.what() << "\n";
+        print_result("GraphQL batch checks against the mock API", false);
+    }
+}
+
+/*!
+ * @brief Sequential checks over a reusable Client
+ *
+ * Offline: consecutive checks on one Client must share a single keep-alive
+ * connection to the mock GitHub API
+ */
+void test_client_reuse() {
+    try {
+        ghupdate::fixtures::MockGitHubServer server;
+        server.set_release("mock/app", "v2.0.0");
+        const std::string url = server.api_url("mock/app");
+
+        ghupdate::Client client;
+        auto first = client.check(url, "1.0.0");
+        auto second = client.check(url, "9.0.0");
+        auto third = client.check(url, "2.0.0");
+
+        const auto stats = server.stats();
+        bool pass = first.hasUpdate && !second.hasUpdate && !third.hasUpdate &&
+                    first.latestVersion == "v2.0.0" && second.latestVersion == first.latestVersion &&
+                    stats.requests == 3 && stats.connections == 1;
+
+        print_result("Client reuse", pass);
+    } catch (const std::exception& e) {
+        std::cerr << "  Exception: " << e.what() << "\n";
+        print_result("Client reuse", false);
+    }
+}
+
+/*!
+ * @brief Conditional requests with a ValidatorStore
+ *
+ * Offline: the second check sends the recorded ETag and is answered with
+ * 304 Not Modified; after a restart (new Client, store reloaded from its
+ * file) the next check is a 304 as well
+ */
+void test_conditional_request() {
+    try {
+        auto file = std::filesystem::temp_directory_path() / "gh-update-checker-test-etags.json";
+        std::filesystem::remove(file);
+
+        ghupdate::fixtures::MockGitHubServer server;
+        server.set_release("mock/app", "v2.0.0");
+        const std::string url = server.api_url("mock/app");
+
+        bool pass = false;
+        {
+            ghupdate::ValidatorStore store(file);
+            ghupdate::Client client;
+            auto first = client.check(url, "1.0.0", {.validators = &store});
+            auto second = client.check(url, "9.0.0", {.validators = &store});
+            pass = store.size() == 1 && !first.notModified && second.notModified && first.hasUpdate &&
+                   !second.hasUpdate && second.latestVersion == "v2.0.0";
+        }
+        {
+            ghupdate::ValidatorStore store(file);
+            ghupdate::Client client;
+            auto restarted = client.check(url, "1.0.0", {.validators = &store});
+            pass = pass && restarted.notModified && restarted.hasUpdate && restarted.latestVersion == "v2.0.0";
+        }
+        std::filesystem::remove(file);
+
+        const auto stats = server.stats();
+        pass = pass && stats.requests == 3 && stats.notModified == 2 && stats.connections == 2;
+        print_result("Conditional request (ETag)", pass);
+    } catch (const std::exception& e) {
+        std::cerr << "  Exception: " << e.what() << "\n";
+        print_result("Conditional request (ETag)", false);
+    }
+}
+
+/*!
+ * @brief Batch update check
+ *
+ * Offline: results come back in input order, a failing entry does not
+ * affect the others, every completion is reported through
+ * BatchOptions::onComplete, the two workers keep one connection each and a
+ * second run with the same ValidatorStore is answered with 304s
+ */
+void test_batch_update_check() {
+    try {
+        // The latency keeps both workers busy at once, so each opens exactly one connection
+        ghupdate::fixtures::MockGitHubServer server({.latency = std::chrono::milliseconds(50)});
+        server.set_release("mock/a", "v1.1.0");
+        server.set_release("mock/b", "v2.0.0");
+        server.set_release("mock/c", "v3.0.0");
+
+        const std::vector<ghupdate::RepoCheck> repos = {
+            {server.api_url("mock/a"), "1.0.0"},
+            {server.api_url("mock/missing"), "1.0.0"},
+            {server.api_url("mock/b"), "9.0.0"},
+            {server.api_url("mock/c"), "2.0.0"},
+        };
+
+        ghupdate::ValidatorStore validators;
+        std::vector<int> completed(repos.size(), 0);
+        ghupdate::BatchOptions options{.concurrency = 2, .check = {.validators = &validators}};
+        options.onComplete = [&](std::size_t i, const ghupdate::CheckResult&, auto) { ++completed[i]; };
+
+        auto results = ghupdate::check_github_updates(repos, options);
+        bool pass = results.size() == 4 && completed == std::vector<int>{1, 1, 1, 1} &&
+                    results[0] && results[0]->hasUpdate && results[0]->latestVersion == "v1.1.0" &&
+                    !results[1] && results[1].error() == "GitHub API error: Not Found" &&
+                    results[2] && !results[2]->hasUpdate && results[3] && results[3]->hasUpdate;
+
+        auto revalidated = ghupdate::check_github_updates(repos, options);
+        pass = pass && revalidated[0] && revalidated[0]->notModified && revalidated[0]->hasUpdate &&
+               !revalidated[1] && revalidated[2] && revalidated[2]->notModified && revalidated[3] &&
+               revalidated[3]->notModified && revalidated[3]->latestVersion == "v3.0.0";
+
+        const auto stats = server.stats();
+        pass = pass && stats.requests == 8 && stats.notModified == 3 && stats.connections == 4;
+        print_result("Batch update check", pass);
+    } catch (const std::exception& e) {
+        std::cerr << "  Exception: " << e.what() << "\n";
+        print_result("Batch update check", false);
+    }
+}
+
+/*!
+ * @brief Event-loop update checks via MultiEngine
+ *
+ * Offline: six checks with two transfers in flight must be carried by two
+ * keep-alive connections to the mock GitHub API
+ */
+void test_multi_engine() {
+    try {
+        ghupdate::fixtures::MockGitHubServer server({.latency = std::chrono::milliseconds(20)});
+        server.set_release("mock/app", "v2.0.0");
+
+        std::atomic<int> ok{0};
+        std::atomic<int> failed{0};
+        ghupdate::EngineStats stats;
+        {
+            ghupdate::MultiEngine engine({.maxInFlight = 2, .http2Multiplex = false});
+            for (int i = 0; i < 5; ++i) {
+                engine.submit(server.api_url("mock/app"), "1.0.0",
+                              [&](ghupdate::CheckResult r) { (r && r->hasUpdate ? ok : failed)++; });
+            }
+            engine.submit(server.api_url("mock/missing"), "1.0.0",
+                          [&](ghupdate::CheckResult r) { (r ? ok : failed)++; });
+            engine.wait_idle();
+            stats = engine.stats();
+        }
+
+        print_result("MultiEngine update checks", ok == 5 && failed == 1 && stats.transfers == 6 &&
+                     stats.newConnections == 2 && server.stats().connections == 2 &&
+                     server.stats().requests == 6);
+    } catch (const std::exception& e) {
+        std::cerr << "  Exception: " << e.what() << "\n";
+        print_result("MultiEngine update checks", false);
+    }
+}
+
+/*!
+ * @brief Per-check timings requested with CheckOptions::collectMetrics
+ *
+ * Offline: the first check opens the connection, the second is answered
+ * with an injected 503 and retried on the same connection, so its metrics
+ * must cover two attempts: two server round trips and the (jittered, at
+ * most 1 ms) backoff wait
+ */
+void test_check_metrics() {
+    try {
+        using namespace std::chrono_literals;
+        ghupdate::fixtures::MockGitHubServer server({.latency = 10ms, .errorEvery = 2});
+        // tag_name at the very end, so the extractor has to scan the whole document
+        server.set_release("mock/app", "v2.0.0", {160, 64 * 1024, true});
+        const std::string url = server.api_url("mock/app");
+
+        ghupdate::Client client;
+        const ghupdate::CheckOptions options{.retry = {.initialBackoff = 1ms}, .collectMetrics = true};
+        auto first = client.check(url, "1.0.0", options);   // Request 1
+        auto second = client.check(url, "1.0.0", options);  // Requests 2 (503) and 3
+        auto plain = client.check(url, "1.0.0");            // Requests 4 (503) and 5
+
+        bool pass = first.metrics && second.metrics && !plain.metrics && first.hasUpdate && second.hasUpdate;
+        if (pass) {
+            const ghupdate::CheckMetrics& a = *first.metrics;
+            const ghupdate::CheckMetrics& b = *second.metrics;
+            pass = a.attempts == 1 && !a.connectionReused && a.wait == 0us && a.tagParse > 0us &&
+                   a.firstByte >= 5ms && a.total >= a.firstByte + a.tagParse &&
+                   b.attempts == 2 && b.connectionReused && b.wait <= 1ms && b.tagParse > 0us &&
+                   b.total >= 20ms && b.total >= b.wait + b.firstByte;
+        }
+
+        pass = pass && server.stats().requests == 5 && server.stats().errors == 2 &&
+               server.stats().connections == 1;
+        print_result("Check metrics", pass);
+    } catch (const std::exception& e) {
+        std::cerr << "  Exception: " << e.what() << "\n";
+        print_result("Check metrics", false);
+    }
+}
+#endif
+
+/*!
+ * @brief Checks over a custom Transport
+ *
+ * Offline: an in-process fake serves the release in small chunks, fails
+ * once, and answers revalidation with 304; CurlTransport talks to the mock
+ * GitHub API
+ */
+void test_custom_transport() {
+    struct FakeTransport : ghupdate::Transport {
+        std::string body = ghupdate::fixtures::release_json("fake/app", "v4.0.0");
+        int failures = 1;
+        std::vector<std::string> seenHeaders;
+
+        ghupdate::HttpResponse get(const ghupdate::TransportRequest& request, const BodySink& onBody) override {
+            if (failures-- > 0)
+                throw std::runtime_error("connection reset");
+            seenHeaders.assign(request.headers.begin(), request.headers.end());
+
+            ghupdate::HttpResponse response;
+            ghupdate::parse_response_header("ETag: \"v4\"\r\n", response);
+            ghupdate::parse_response_header("x-ratelimit-remaining: 99\r\n", response);
+            if (!seenHeaders.empty() && seenHeaders[0] == "If-None-Match: \"v4\"") {
+                response.status = 304;
+                return response;
+            }
+            response.status = 200;
+            for (std::size_t i = 0; i < body.size() && onBody(std::string_view(body).substr(i, 512)); i += 512) {
+            }
+            return response;
+        }
+    };
+
+    try {
+        FakeTransport fake;
+        ghupdate::MetricsRegistry registry;
+        ghupdate::ValidatorStore validators;
+        const ghupdate::CheckOptions options{.validators = &validators,
+                                             .retry = {.initialBackoff = std::chrono::milliseconds(1)},
+                                             .metrics = &registry,
+                                             .transport = &fake};
+        const std::string url = "https://github.com/fake/app";
+        auto first = ghupdate::check_github_update(url, "3.9.0", options);
+        auto second = ghupdate::check_github_update(url, "4.0.0", options);
+        bool pass = first.hasUpdate && first.latestVersion == "v4.0.0" && !second.hasUpdate &&
+                    second.notModified && registry.retries.value() == 1 &&
+                    registry.rateLimitRemaining.value() == 99 && registry.phases[0].bucket(0) == 0;
+
+        fake.failures = 5;
+        try {
+            ghupdate::check_github_update(url, "4.0.0", options);
+            pass = false;
+        } catch (const std::runtime_error& e) {
+            pass = pass && std::string(e.what()) == "HTTP request failed: connection reset";
+        }
+
+#ifdef GHUPDATE_TEST_SOCKETS
+        ghupdate::fixtures::MockGitHubServer server;
+        server.set_release("mock/app", "v1.5.0");
+        ghupdate::CurlTransport curl;
+        auto info = ghupdate::check_github_update(server.api_url("mock/app"), "1.4.0", {.transport = &curl});
+        pass = pass && info.hasUpdate && info.latestVersion == "v1.5.0";
+#endif
+
+        print_result("Custom transport", pass);
+    } catch (const std::exception& e) {
+        std::cerr << "  Exception: " << e.what() << "\n";
+        print_result("Custom transport", false);
+    }
+}
+
 /*!
  * @brief Test 3: Synchronous update check with standard GitHub URL
  *
@@ -261,6 +1396,32 @@ int main() {
     std::cout << "--- Unit Tests ---\n";
     test_semver_parsing();
     test_semver_comparison();
+    test_semver_constexpr();
+    test_semver_prerelease();
+    test_tag_extraction();
+    test_url_normalization();
+    test_disk_cache();
+    test_update_cache();
+    test_graphql_batch();
+    test_ls_refs_scanner();
+    test_rate_limit_scheduler();
+    test_retry_policy();
+    test_stop_token();
+    test_coroutine_check();
+    test_watcher();
+    test_latency_histogram();
+    test_metrics_registry();
+#ifdef GHUPDATE_TEST_SOCKETS
+    test_mock_server();
+    test_multi_engine_errors();
+    test_graphql_mock();
+    test_client_reuse();
+    test_conditional_request();
+    test_batch_update_check();
+    test_multi_engine();
+    test_check_metrics();
+#endif
+    test_custom_transport();
 
     std::cout << "\n--- Integration Tests (requires network) ---\n";
     test_sync_update_check_standard_url();